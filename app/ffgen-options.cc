@@ -12,6 +12,7 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
 {
   const struct option long_options[] = {
     {"bv-size", required_argument, 0, OPTION_BV_SIZE},
+    {"chunk-size", required_argument, 0, OPTION_CHUNK_SIZE},
     {"coupling-constant", required_argument, 0, OPTION_COUPLING_CONSTANT},
     {"ep-upper-bound", required_argument, 0, OPTION_EP_UPPER_BOUND},
     {"field-constant", required_argument, 0, OPTION_FIELD_CONSTANT},
@@ -27,6 +28,7 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
     {"nn2-generator", required_argument, 0, OPTION_NN2_GENERATOR},
     {"nn2-num-columns", required_argument, 0, OPTION_NN2_NUM_COLUMNS},
     {"nn2-num-rows", required_argument, 0, OPTION_NN2_NUM_ROWS},
+    {"num-threads", required_argument, 0, OPTION_NUM_THREADS},
     {"part-upper-bound", required_argument, 0, OPTION_PART_UPPER_BOUND},
     {"path", required_argument, 0, OPTION_PATH},
     {"seed", required_argument, 0, OPTION_SEED},
@@ -35,6 +37,7 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
     {"walsh2-generator", required_argument, 0, OPTION_WALSH2_GENERATOR},
     {"walsh2-ising-alpha", required_argument, 0, OPTION_WALSH2_ISING_ALPHA},
     {"walsh-num-features", required_argument, 0, OPTION_WALSH_NUM_FEATURES},
+    {"binary", no_argument, 0, OPTION_BINARY},
     {"ms-planted-solution", no_argument, 0, OPTION_MS_PLANTED_SOLUTION},
     {"periodic-boundary-conditions", no_argument, 0, OPTION_PERIODIC_BOUNDARY_CONDITIONS},
     {"version", no_argument, 0, OPTION_VERSION},
@@ -54,6 +57,11 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
       _bv_size = std::atoi(optarg);
       break;
 
+    case OPTION_CHUNK_SIZE:
+      _with_chunk_size = true;
+      _chunk_size = std::atoi(optarg);
+      break;
+
     case OPTION_COUPLING_CONSTANT:
       _with_coupling_constant = true;
       _coupling_constant = std::atof(optarg);
@@ -130,6 +138,11 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
       _nn2_num_rows = std::atoi(optarg);
       break;
 
+    case OPTION_NUM_THREADS:
+      _with_num_threads = true;
+      _num_threads = std::atoi(optarg);
+      break;
+
     case OPTION_PART_UPPER_BOUND:
       _with_part_upper_bound = true;
       _part_upper_bound = std::atoi(optarg);
@@ -171,6 +184,10 @@ FfgenOptions::FfgenOptions(int argc, char *argv[], bool ignore_bad_options):
       _walsh_num_features = std::atoi(optarg);
       break;
 
+    case OPTION_BINARY:
+      _binary = true;
+      break;
+
     case OPTION_MS_PLANTED_SOLUTION:
       _ms_planted_solution = true;
       break;
@@ -201,8 +218,12 @@ void FfgenOptions::print_help(std::ostream& stream) const
   stream << "Fitness function generator for HNCO" << std::endl << std::endl;
   stream << "usage: " << _exec_name << " [--help] [--version] [options]" << std::endl << std::endl;
   stream << "General" << std::endl;
+  stream << "      --binary" << std::endl;
+  stream << "          Write the instance in the binary format" << std::endl;
   stream << "  -s, --bv-size (type int, default to 100)" << std::endl;
   stream << "          Size of bit vectors" << std::endl;
+  stream << "      --chunk-size (type int, default to 0)" << std::endl;
+  stream << "          Size of chunks of random numbers generated in parallel (<= 0 means sequential generation)" << std::endl;
   stream << "  -F, --function (type int, default to 1)" << std::endl;
   stream << "          Type of function" << std::endl;
   stream << "            1: Linear function" << std::endl;
@@ -216,6 +237,8 @@ void FfgenOptions::print_help(std::ostream& stream) const
   stream << "            171: Nearest neighbor Ising model in one dimension" << std::endl;
   stream << "            172: Nearest neighbor Ising model in two dimensions" << std::endl;
   stream << "            190: Sudoku" << std::endl;
+  stream << "      --num-threads (type int, default to 1)" << std::endl;
+  stream << "          Number of threads" << std::endl;
   stream << "  -p, --path (type string, default to \"function.txt\")" << std::endl;
   stream << "          Path (relative or absolute) of a function file" << std::endl;
   stream << "      --seed (type int, no default)" << std::endl;
@@ -311,6 +334,7 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const FfgenOptions& op
 {
   stream << std::boolalpha;
   stream << "# bv_size = " << options._bv_size << std::endl;
+  stream << "# chunk_size = " << options._chunk_size << std::endl;
   stream << "# coupling_constant = " << options._coupling_constant << std::endl;
   stream << "# ep_upper_bound = " << options._ep_upper_bound << std::endl;
   stream << "# field_constant = " << options._field_constant << std::endl;
@@ -326,6 +350,7 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const FfgenOptions& op
   stream << "# nn2_generator = " << options._nn2_generator << std::endl;
   stream << "# nn2_num_columns = " << options._nn2_num_columns << std::endl;
   stream << "# nn2_num_rows = " << options._nn2_num_rows << std::endl;
+  stream << "# num_threads = " << options._num_threads << std::endl;
   stream << "# part_upper_bound = " << options._part_upper_bound << std::endl;
   stream << "# path = \"" << options._path << "\"" << std::endl;
   if (options._with_seed)
@@ -335,6 +360,8 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const FfgenOptions& op
   stream << "# walsh2_generator = " << options._walsh2_generator << std::endl;
   stream << "# walsh2_ising_alpha = " << options._walsh2_ising_alpha << std::endl;
   stream << "# walsh_num_features = " << options._walsh_num_features << std::endl;
+  if (options._binary)
+    stream << "# binary " << std::endl;
   if (options._ms_planted_solution)
     stream << "# ms_planted_solution " << std::endl;
   if (options._periodic_boundary_conditions)
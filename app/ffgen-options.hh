@@ -20,6 +20,7 @@ class FfgenOptions {
     OPTION_HELP=256,
     OPTION_VERSION,
     OPTION_BV_SIZE,
+    OPTION_CHUNK_SIZE,
     OPTION_COUPLING_CONSTANT,
     OPTION_EP_UPPER_BOUND,
     OPTION_FIELD_CONSTANT,
@@ -35,6 +36,7 @@ class FfgenOptions {
     OPTION_NN2_GENERATOR,
     OPTION_NN2_NUM_COLUMNS,
     OPTION_NN2_NUM_ROWS,
+    OPTION_NUM_THREADS,
     OPTION_PART_UPPER_BOUND,
     OPTION_PATH,
     OPTION_SEED,
@@ -43,6 +45,7 @@ class FfgenOptions {
     OPTION_WALSH2_GENERATOR,
     OPTION_WALSH2_ISING_ALPHA,
     OPTION_WALSH_NUM_FEATURES,
+    OPTION_BINARY,
     OPTION_MS_PLANTED_SOLUTION,
     OPTION_PERIODIC_BOUNDARY_CONDITIONS
   };
@@ -51,6 +54,10 @@ class FfgenOptions {
   int _bv_size = 100;
   bool _with_bv_size = false;
 
+  /// Size of chunks of random numbers generated in parallel (<= 0 means sequential generation)
+  int _chunk_size = 0;
+  bool _with_chunk_size = false;
+
   /// Coupling constant
   double _coupling_constant = 1;
   bool _with_coupling_constant = false;
@@ -111,6 +118,10 @@ class FfgenOptions {
   int _nn2_num_rows = 10;
   bool _with_nn2_num_rows = false;
 
+  /// Number of threads
+  int _num_threads = 1;
+  bool _with_num_threads = false;
+
   /// Upper bound of numbers
   int _part_upper_bound = 100;
   bool _with_part_upper_bound = false;
@@ -143,6 +154,9 @@ class FfgenOptions {
   int _walsh_num_features = 100;
   bool _with_walsh_num_features = false;
 
+  /// Write the instance in the binary format
+  bool _binary = false;
+
   /// Generate an instance with a planted solution
   bool _ms_planted_solution = false;
 
@@ -169,6 +183,12 @@ public:
   /// With parameter bv_size
   bool with_bv_size() const { return _with_bv_size; }
 
+  /// Get the value of chunk_size
+  int get_chunk_size() const { return _chunk_size; }
+
+  /// With parameter chunk_size
+  bool with_chunk_size() const { return _with_chunk_size; }
+
   /// Get the value of coupling_constant
   double get_coupling_constant() const { return _coupling_constant; }
 
@@ -259,6 +279,12 @@ public:
   /// With parameter nn2_num_rows
   bool with_nn2_num_rows() const { return _with_nn2_num_rows; }
 
+  /// Get the value of num_threads
+  int get_num_threads() const { return _num_threads; }
+
+  /// With parameter num_threads
+  bool with_num_threads() const { return _with_num_threads; }
+
   /// Get the value of part_upper_bound
   int get_part_upper_bound() const { return _part_upper_bound; }
 
@@ -312,6 +338,9 @@ public:
   /// With parameter walsh_num_features
   bool with_walsh_num_features() const { return _with_walsh_num_features; }
 
+  /// With the flag binary
+  bool with_binary() const { return _binary; }
+
   /// With the flag ms_planted_solution
   bool with_ms_planted_solution() const { return _ms_planted_solution; }
 
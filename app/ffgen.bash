@@ -4,7 +4,7 @@ _ffgen()
     COMPREPLY=()
     cur="${COMP_WORDS[COMP_CWORD]}"
     prev="${COMP_WORDS[COMP_CWORD-1]}"
-    opts="--bv-size --coupling-constant --ep-upper-bound --field-constant --function --lin-distance --lin-generator --lin-initial-weight --lin-ratio --ms-num-clauses --ms-num-literals-per-clause --nk-k --nn1-generator --nn2-generator --nn2-num-columns --nn2-num-rows --part-upper-bound --path --seed --stddev --sudoku-num-empty-cells --walsh2-generator --walsh2-ising-alpha --walsh-num-features --help --ms-planted-solution --periodic-boundary-conditions --version"
+    opts="--bv-size --chunk-size --coupling-constant --ep-upper-bound --field-constant --function --lin-distance --lin-generator --lin-initial-weight --lin-ratio --ms-num-clauses --ms-num-literals-per-clause --nk-k --nn1-generator --nn2-generator --nn2-num-columns --nn2-num-rows --num-threads --part-upper-bound --path --seed --stddev --sudoku-num-empty-cells --walsh2-generator --walsh2-ising-alpha --walsh-num-features --binary --help --ms-planted-solution --periodic-boundary-conditions --version"
 
     if [[ ${cur} == -* ]] ; then
         COMPREPLY=( $(compgen -W "${opts}" -- ${cur}) )
@@ -18,13 +18,18 @@
 
 */
 
+#include <omp.h>                // omp_set_num_threads
+
+#include <functional>           // std::function
 #include <iostream>
+#include <memory>               // std::make_shared
 #include <string>
 
 #include "hnco/bit-vector.hh"
 #include "hnco/exception.hh"
 #include "hnco/functions/all.hh"
 #include "hnco/random.hh"
+#include "hnco/serialization.hh"
 
 #include "ffgen-options.hh"
 
@@ -36,6 +41,50 @@ using namespace hnco;
 using namespace hnco::app;
 
 
+/** Save an instance.
+
+    With option binary, the instance is written in the binary format
+    which hnco memory-maps at load time.
+*/
+template<class T>
+void save_instance(const T& instance, std::string name, FfgenOptions& options)
+{
+  std::cout << "Writing " << name << " to " << options.get_path() << " ... ";
+  if (options.with_binary())
+    save_to_binary_archive(instance, options.get_path(), name);
+  else
+    instance.save(options.get_path());
+  std::cout << "done" << std::endl;
+}
+
+
+/** Make a generator of random numbers.
+
+    With a positive chunk size, numbers are drawn from a
+    ChunkedStream seeded with Generator::seed, hence generated in
+    parallel. Otherwise, they are drawn sequentially from
+    Generator::engine.
+
+    Copies of the returned generator share the same stream.
+*/
+template<class Distribution>
+std::function<double()> make_generator(Distribution distribution, FfgenOptions& options)
+{
+  if (options.get_chunk_size() > 0) {
+    auto stream = std::make_shared<ChunkedStream<Distribution>>
+      (distribution, Generator::seed, options.get_chunk_size(), 4 * options.get_num_threads());
+    return [stream]() { return (*stream)(); };
+  }
+  return [distribution]() { Distribution d(distribution); return d(Generator::engine); };
+}
+
+/// Make a generator of normal random numbers with standard deviation stddev
+std::function<double()> make_normal_generator(FfgenOptions& options)
+{
+  return make_generator(std::normal_distribution<double>(0, options.get_stddev()), options);
+}
+
+
 void generate_linear_function(FfgenOptions& options)
 {
   LinearFunction instance;
@@ -43,9 +92,7 @@ void generate_linear_function(FfgenOptions& options)
   switch (options.get_lin_generator()) {
 
   case 0: {
-    double stddev = options.get_stddev();
-    auto generator = [stddev]() { return stddev * Generator::normal(); };
-    instance.generate(options.get_bv_size(), generator);
+    instance.generate(options.get_bv_size(), make_normal_generator(options));
     break;
   }
 
@@ -67,16 +114,13 @@ void generate_linear_function(FfgenOptions& options)
     throw std::runtime_error("generate_linear_function: unknown generator: " + std::to_string(options.get_lin_generator()));
   }
 
-  std::cout << "Writing LinearFunction to " << options.get_path() << " ... ";
-  instance.save(options.get_path());
-  std::cout << "done" << std::endl;
+  save_instance(instance, "LinearFunction", options);
 }
 
 
 void generate_walsh_expansion_2(FfgenOptions& options)
 {
-  double stddev = options.get_stddev();
-  auto generator = [stddev]() { return stddev * Generator::normal(); };
+  auto generator = make_normal_generator(options);
   WalshExpansion2 instance;
 
   switch (options.get_walsh2_generator()) {
@@ -93,15 +137,13 @@ void generate_walsh_expansion_2(FfgenOptions& options)
     throw std::runtime_error("generate_walsh_expansion_2: unknown generator: " + std::to_string(options.get_walsh2_generator()));
   }
 
-  std::cout << "Writing WalshExpansion2 to " << options.get_path() << " ... ";
-  instance.save(options.get_path());
-  std::cout << "done" << std::endl;
+  save_instance(instance, "WalshExpansion2", options);
 }
 
 
 void generate_nearest_neighbor_ising_model_1(FfgenOptions& options)
 {
-  auto generator = [&options]() { return options.get_stddev() * Generator::normal(); };
+  auto generator = make_normal_generator(options);
   NearestNeighborIsingModel1 instance;
 
   switch (options.get_nn1_generator()) {
@@ -135,15 +177,13 @@ void generate_nearest_neighbor_ising_model_1(FfgenOptions& options)
   }
 
   instance.set_periodic_boundary_conditions(options.with_periodic_boundary_conditions());
-  std::cout << "Writing NearestNeighborIsingModel1 to " << options.get_path() << " ... ";
-  instance.save(options.get_path());
-  std::cout << "done" << std::endl;
+  save_instance(instance, "NearestNeighborIsingModel1", options);
 }
 
 
 void generate_nearest_neighbor_ising_model_2(FfgenOptions& options)
 {
-  auto generator = [&options]() { return options.get_stddev() * Generator::normal(); };
+  auto generator = make_normal_generator(options);
   NearestNeighborIsingModel2 instance;
 
   switch (options.get_nn2_generator()) {
@@ -186,16 +226,13 @@ void generate_nearest_neighbor_ising_model_2(FfgenOptions& options)
       << " to " << instance.get_bv_size() << std::endl;
 
   instance.set_periodic_boundary_conditions(options.with_periodic_boundary_conditions());
-  std::cout << "Writing NearestNeighborIsingModel2 to " << options.get_path() << " ... ";
-  instance.save(options.get_path());
-  std::cout << "done" << std::endl;
+  save_instance(instance, "NearestNeighborIsingModel2", options);
 }
 
 
 void generate_function(FfgenOptions& options)
 {
-  double stddev = options.get_stddev();
-  auto generator = [stddev]() { return stddev * Generator::normal(); };
+  auto generator = make_normal_generator(options);
 
   switch(options.get_function()) {
 
@@ -205,10 +242,12 @@ void generate_function(FfgenOptions& options)
 
   case 60: {
     NkLandscape instance;
-    instance.generate(options.get_bv_size(), options.get_nk_k(), generator);
-    std::cout << "Writing NkLandscape to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    if (options.get_chunk_size() > 0)
+      instance.generate_in_chunks(options.get_bv_size(), options.get_nk_k(), options.get_stddev(),
+                                  Generator::seed, options.get_chunk_size());
+    else
+      instance.generate(options.get_bv_size(), options.get_nk_k(), generator);
+    save_instance(instance, "NkLandscape", options);
     break;
   }
 
@@ -225,46 +264,36 @@ void generate_function(FfgenOptions& options)
                       options.get_ms_num_literals_per_clause(),
                       options.get_ms_num_clauses());
     }
-    std::cout << "Writing MaxSat to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    save_instance(instance, "MaxSat", options);
     break;
   }
 
   case 90: {
     EqualProducts instance;
     double upper_bound = options.get_ep_upper_bound();
-    instance.generate(options.get_bv_size(), [upper_bound]() { return upper_bound * Generator::uniform(); });
-    std::cout << "Writing EqualProducts to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    instance.generate(options.get_bv_size(), make_generator(std::uniform_real_distribution<double>(0, upper_bound), options));
+    save_instance(instance, "EqualProducts", options);
     break;
   }
 
   case 91: {
     Partition instance;
     instance.random(options.get_bv_size(), options.get_part_upper_bound());
-    std::cout << "Writing Partition to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    save_instance(instance, "Partition", options);
     break;
   }
 
   case 160: {
     WalshExpansion instance;
     instance.generate(options.get_bv_size(), options.get_walsh_num_features(), generator);
-    std::cout << "Writing WalshExpansion to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    save_instance(instance, "WalshExpansion", options);
     break;
   }
 
   case 161: {
     WalshExpansion1 instance;
     instance.generate(options.get_bv_size(), generator);
-    std::cout << "Writing WalshExpansion1 to " << options.get_path() << " ... ";
-    instance.save(options.get_path());
-    std::cout << "done" << std::endl;
+    save_instance(instance, "WalshExpansion1", options);
     break;
   }
 
@@ -283,6 +312,8 @@ void generate_function(FfgenOptions& options)
   case 190: {
     Sudoku instance;
     instance.random(options.get_sudoku_num_empty_cells());
+    if (options.with_binary())
+      std::cerr << "Warning: Sudoku instances are always written in text format" << std::endl;
     instance.save(options.get_path());
     break;
   }
@@ -307,6 +338,16 @@ int main(int argc, char *argv[])
   else
     Generator::set_seed();
 
+  //
+  // OpenMP
+  //
+
+  if (options.get_num_threads() < 1) {
+    std::cerr << "main: At least one thread is required" << std::endl;
+    return 1;
+  }
+  omp_set_num_threads(options.get_num_threads());
+
   try {
     generate_function(options);
   }
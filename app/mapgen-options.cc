@@ -18,6 +18,7 @@ MapgenOptions::MapgenOptions(int argc, char *argv[], bool ignore_bad_options):
     {"seed", required_argument, 0, OPTION_SEED},
     {"ts-length", required_argument, 0, OPTION_TS_LENGTH},
     {"ts-sampling-mode", required_argument, 0, OPTION_TS_SAMPLING_MODE},
+    {"binary", no_argument, 0, OPTION_BINARY},
     {"surjective", no_argument, 0, OPTION_SURJECTIVE},
     {"version", no_argument, 0, OPTION_VERSION},
     {"help", no_argument, 0, OPTION_HELP},
@@ -69,6 +70,10 @@ MapgenOptions::MapgenOptions(int argc, char *argv[], bool ignore_bad_options):
       _ts_sampling_mode = std::atoi(optarg);
       break;
 
+    case OPTION_BINARY:
+      _binary = true;
+      break;
+
     case OPTION_SURJECTIVE:
       _surjective = true;
       break;
@@ -94,6 +99,8 @@ void MapgenOptions::print_help(std::ostream& stream) const
 {
   stream << "Map generator for HNCO" << std::endl << std::endl;
   stream << "usage: " << _exec_name << " [--help] [--version] [options]" << std::endl << std::endl;
+  stream << "      --binary" << std::endl;
+  stream << "          Write the map in the binary format" << std::endl;
   stream << "  -x, --input-size (type int, default to 100)" << std::endl;
   stream << "          Input bit vector size" << std::endl;
   stream << "  -M, --map (type int, default to 1)" << std::endl;
@@ -140,6 +147,8 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const MapgenOptions& o
     stream << "# seed = " << options._seed << std::endl;
   stream << "# ts_length = " << options._ts_length << std::endl;
   stream << "# ts_sampling_mode = " << options._ts_sampling_mode << std::endl;
+  if (options._binary)
+    stream << "# binary " << std::endl;
   if (options._surjective)
     stream << "# surjective " << std::endl;
   stream << "# last_parameter" << std::endl;
@@ -26,6 +26,7 @@ class MapgenOptions {
     OPTION_SEED,
     OPTION_TS_LENGTH,
     OPTION_TS_SAMPLING_MODE,
+    OPTION_BINARY,
     OPTION_SURJECTIVE
   };
 
@@ -57,6 +58,9 @@ class MapgenOptions {
   int _ts_sampling_mode = 0;
   bool _with_ts_sampling_mode = false;
 
+  /// Write the map in the binary format
+  bool _binary = false;
+
   /// Ensure that the sampled linear or affine map is surjective
   bool _surjective = false;
 
@@ -121,6 +125,9 @@ public:
   /// With parameter ts_sampling_mode
   bool with_ts_sampling_mode() const { return _with_ts_sampling_mode; }
 
+  /// With the flag binary
+  bool with_binary() const { return _binary; }
+
   /// With the flag surjective
   bool with_surjective() const { return _surjective; }
 
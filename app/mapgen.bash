@@ -4,7 +4,7 @@ _mapgen()
     COMPREPLY=()
     cur="${COMP_WORDS[COMP_CWORD]}"
     prev="${COMP_WORDS[COMP_CWORD-1]}"
-    opts="--input-size --map --output-size --path --seed --ts-length --ts-sampling-mode --help --surjective --version"
+    opts="--input-size --map --output-size --path --seed --ts-length --ts-sampling-mode --binary --help --surjective --version"
 
     if [[ ${cur} == -* ]] ; then
         COMPREPLY=( $(compgen -W "${opts}" -- ${cur}) )
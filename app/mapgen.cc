@@ -20,10 +20,14 @@
 
 #include <iostream>
 #include <fstream>
+#include <utility>              // std::pair
+
+#include <boost/serialization/utility.hpp>
 
 #include "hnco/exception.hh"
 #include "hnco/maps/map.hh"
 #include "hnco/random.hh"
+#include "hnco/serialization.hh"
 
 #include "mapgen-options.hh"
 
@@ -35,6 +39,23 @@ using namespace hnco::random;
 using namespace hnco;
 
 
+/** Save a map.
+
+    With option binary, the map is written in the binary format which
+    hnco memory-maps at load time.
+*/
+template<class T>
+void save_map(const T& map, std::string name, std::string description, MapgenOptions& options)
+{
+  std::cout << "Writing " << description << " to " << options.get_path() << " ... ";
+  if (options.with_binary())
+    save_to_binary_archive(map, options.get_path(), name);
+  else
+    map.save(options.get_path());
+  std::cout << "done" << std::endl;
+}
+
+
 void generate_map(MapgenOptions& options)
 {
   switch(options.get_map()) {
@@ -42,22 +63,14 @@ void generate_map(MapgenOptions& options)
   case 1: {
     Translation map;
     map.random(options.get_output_size());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
-    std::cout << "Writing translation to " << options.get_path() << " ... ";
-    archive << map;
-    std::cout << "done" << std::endl;
+    save_map(map, "Translation", "translation", options);
     break;
   }
 
   case 2: {
     Permutation map;
     map.random(options.get_output_size());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
-    std::cout << "Writing permutation to " << options.get_path() << " ... ";
-    archive << map;
-    std::cout << "done" << std::endl;
+    save_map(map, "Permutation", "permutation", options);
     break;
   }
 
@@ -66,10 +79,14 @@ void generate_map(MapgenOptions& options)
     Translation translation;
     permutation.random(options.get_output_size());
     translation.random(options.get_output_size());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
     std::cout << "Writing permutation and translation to " << options.get_path() << " ... ";
-    archive << permutation << translation;
+    if (options.with_binary()) {
+      save_to_binary_archive(std::make_pair(permutation, translation), options.get_path(), "PermutationTranslation");
+    } else {
+      std::ofstream stream(options.get_path());
+      boost::archive::text_oarchive archive(stream);
+      archive << permutation << translation;
+    }
     std::cout << "done" << std::endl;
     break;
   }
@@ -77,22 +94,14 @@ void generate_map(MapgenOptions& options)
   case 4: {
     LinearMap map;
     map.random(options.get_output_size(), options.get_input_size(), options.with_surjective());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
-    std::cout << "Writing linear map to " << options.get_path() << " ... ";
-    archive << map;
-    std::cout << "done" << std::endl;
+    save_map(map, "LinearMap", "linear map", options);
     break;
   }
 
   case 5: {
     AffineMap map;
     map.random(options.get_output_size(), options.get_input_size(), options.with_surjective());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
-    std::cout << "Writing affine map to " << options.get_path() << " ... ";
-    archive << map;
-    std::cout << "done" << std::endl;
+    save_map(map, "AffineMap", "affine map", options);
     break;
   }
 
@@ -103,11 +112,7 @@ void generate_map(MapgenOptions& options)
     map.random(options.get_input_size(),
                options.get_ts_length(),
                options.get_ts_sampling_mode());
-    std::ofstream stream(options.get_path());
-    boost::archive::text_oarchive archive(stream);
-    std::cout << "Writing affine map (transvection sequence) to " << options.get_path() << " ... ";
-    archive << map;
-    std::cout << "done" << std::endl;
+    save_map(map, "TsAffineMap", "affine map (transvection sequence)", options);
     break;
   }
 
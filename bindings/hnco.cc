@@ -679,6 +679,8 @@ PYBIND11_MODULE(hnco, m_hnco) {
     py::class_<StopOnTarget, Controller>(m_ctrl, "StopOnTarget")
       .def(py::init<function::Function *, double>())
       .def("get_trigger", &StopOnTarget::get_trigger)
+      .def("is_target_reached", &StopOnTarget::is_target_reached)
+      .def("reset", &StopOnTarget::reset)
       ;
 
     py::class_<StopOnMaximum, StopOnTarget>(m_ctrl, "StopOnMaximum")
@@ -697,12 +699,21 @@ PYBIND11_MODULE(hnco, m_hnco) {
     py::class_<ProgressTracker::Event>(m_ctrl, "Event")
       ;
 
+    py::class_<ProgressTracker::TraceEntry>(m_ctrl, "TraceEntry")
+      .def_readonly("num_evaluations", &ProgressTracker::TraceEntry::num_evaluations)
+      .def_readonly("value", &ProgressTracker::TraceEntry::value)
+      .def_readonly("time", &ProgressTracker::TraceEntry::time)
+      .def_readonly("flipped_bits", &ProgressTracker::TraceEntry::flipped_bits)
+      ;
+
     py::class_<ProgressTracker, CallCounter>(m_ctrl, "ProgressTracker")
       .def(py::init<function::Function *>())
       .def("set_log_improvement", &ProgressTracker::set_log_improvement)
       .def("set_record_evaluation_time", &ProgressTracker::set_record_evaluation_time)
       .def("get_evaluation_time", &ProgressTracker::get_evaluation_time)
       .def("get_last_improvement", &ProgressTracker::get_last_improvement)
+      .def("set_record_trace", &ProgressTracker::set_record_trace)
+      .def("get_trace", &ProgressTracker::get_trace)
       ;
 
     py::class_<Cache, Controller>(m_ctrl, "Cache")
@@ -903,6 +914,17 @@ PYBIND11_MODULE(hnco, m_hnco) {
       .def("set_allow_no_mutation", &MuPlusLambdaEa::set_allow_no_mutation)
       ;
 
+    py::class_<SteadyStateAlgorithm, IterativeAlgorithm>(m_algo, "SteadyStateAlgorithm")
+      .def("get_num_evaluations", &SteadyStateAlgorithm::get_num_evaluations)
+      .def("get_throughput", &SteadyStateAlgorithm::get_throughput)
+      ;
+
+    py::class_<MuPlusOneEa, SteadyStateAlgorithm>(m_algo, "MuPlusOneEa")
+      .def(py::init<int, int>())
+      .def("set_mutation_rate", &MuPlusOneEa::set_mutation_rate)
+      .def("set_allow_no_mutation", &MuPlusOneEa::set_allow_no_mutation)
+      ;
+
     py::class_<MuCommaLambdaEa, IterativeAlgorithm>(m_algo, "MuCommaLambdaEa")
       .def(py::init<int, int, int>())
       .def("set_mutation_rate", &MuCommaLambdaEa::set_mutation_rate)
@@ -935,6 +957,14 @@ PYBIND11_MODULE(hnco, m_hnco) {
       .def("set_allow_no_mutation", &GeneticAlgorithm::set_allow_no_mutation)
       ;
 
+    py::class_<SteadyStateGa, SteadyStateAlgorithm>(m_algo, "SteadyStateGa")
+      .def(py::init<int, int>())
+      .def("set_mutation_rate", &SteadyStateGa::set_mutation_rate)
+      .def("set_crossover_probability", &SteadyStateGa::set_crossover_probability)
+      .def("set_tournament_size", &SteadyStateGa::set_tournament_size)
+      .def("set_allow_no_mutation", &SteadyStateGa::set_allow_no_mutation)
+      ;
+
     py::class_<OnePlusLambdaCommaLambdaGa, IterativeAlgorithm>(m_algo, "OnePlusLambdaCommaLambdaGa")
       .def(py::init<int, int>())
       .def("set_mutation_rate", &OnePlusLambdaCommaLambdaGa::set_mutation_rate)
@@ -0,0 +1,102 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Benchmark of uniform and biased crossovers.
+
+    Each crossover is compared with a reference implementation which
+    draws one Bernoulli variable per bit. Times are in microseconds
+    per recombination.
+
+    Usage: bench-crossover [bv_size [num_iterations]]
+
+*/
+
+#include <chrono>
+#include <cstdlib>              // std::atoi
+#include <iomanip>              // std::setw
+#include <iostream>
+#include <random>               // std::bernoulli_distribution
+
+#include "hnco/algorithms/evolutionary-algorithms/crossover.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::random;
+using namespace hnco;
+
+
+/// Reference crossover with one Bernoulli variable per bit
+void recombine_bit_by_bit(std::bernoulli_distribution& dist, const bit_vector_t& parent1, const bit_vector_t& parent2, bit_vector_t& offspring)
+{
+  for (size_t i = 0; i < offspring.size(); i++)
+    if (dist(Generator::engine))
+      offspring[i] = parent2[i];
+    else
+      offspring[i] = parent1[i];
+}
+
+/// Time per call in microseconds
+template<class F>
+double time_per_call(F f, int num_iterations)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_iterations; i++)
+    f();
+  std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+  return duration.count() / num_iterations;
+}
+
+int main(int argc, char *argv[])
+{
+  const int bv_size = argc > 1 ? std::atoi(argv[1]) : 100000;
+  const int num_iterations = argc > 2 ? std::atoi(argv[2]) : 100;
+
+  Generator::set_seed();
+
+  bit_vector_t parent1(bv_size);
+  bit_vector_t parent2(bv_size);
+  bit_vector_t offspring(bv_size);
+  bv_random(parent1);
+  bv_random(parent2);
+
+  std::cout << "# bv_size = " << bv_size << std::endl;
+  std::cout << "# crossover reference library" << std::endl;
+
+  {
+    std::bernoulli_distribution dist(0.5);
+    UniformCrossover crossover;
+    double before = time_per_call([&]() { recombine_bit_by_bit(dist, parent1, parent2, offspring); }, num_iterations);
+    double after = time_per_call([&]() { crossover.recombine(parent1, parent2, offspring); }, num_iterations);
+    std::cout << std::setw(14) << "uniform" << " " << before << " " << after << std::endl;
+  }
+
+  for (double bias : {0.01, 0.1, 0.25, 0.5, 0.99}) {
+    std::bernoulli_distribution dist(bias);
+    BiasedCrossover crossover;
+    crossover.set_bias(bias);
+    double before = time_per_call([&]() { recombine_bit_by_bit(dist, parent1, parent2, offspring); }, num_iterations);
+    double after = time_per_call([&]() { crossover.recombine(parent1, parent2, offspring); }, num_iterations);
+    std::cout << std::setw(9) << "biased " << std::setw(5) << bias << " " << before << " " << after << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Benchmark of the overhead of evaluating OneMax on a
+    std::vector<bool>, as done by the bridges to P3 and GOMEA.
+
+    The bit vector conversion of the library is compared with a
+    reference implementation which copies one bit at a time. Times
+    are in nanoseconds per evaluation.
+
+    Usage: bench-vector-bool [bv_size [num_iterations]]
+
+*/
+
+#include <chrono>
+#include <cstdlib>              // std::atoi
+#include <iostream>
+#include <vector>
+
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+/// Time per call in nanoseconds
+template<class F>
+double time_per_call(F f, int num_iterations)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_iterations; i++)
+    f();
+  std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+  return duration.count() / num_iterations;
+}
+
+int main(int argc, char *argv[])
+{
+  const int bv_size = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int num_iterations = argc > 2 ? std::atoi(argv[2]) : 100000;
+
+  Generator::set_seed();
+
+  OneMax function(bv_size);
+  bit_vector_t x(bv_size);
+  bv_random(x);
+  std::vector<bool> y(bv_size);
+  bv_to_vector_bool(y, x);
+
+  // Prevent the compiler from discarding evaluations
+  volatile double sink = 0;
+
+  double direct = time_per_call([&]() { sink = function.evaluate(x); }, num_iterations);
+
+  double before = time_per_call([&]() {
+    for (int i = 0; i < bv_size; i++)
+      x[i] = y[i];
+    sink = function.evaluate(x);
+  }, num_iterations);
+
+  double after = time_per_call([&]() {
+    bv_from_vector_bool(x, y);
+    sink = function.evaluate(x);
+  }, num_iterations);
+
+  std::cout << "# bv_size = " << bv_size << std::endl;
+  std::cout << "direct " << direct << std::endl;
+  std::cout << "bit_by_bit " << before << std::endl;
+  std::cout << "bv_from_vector_bool " << after << std::endl;
+
+  return 0;
+}
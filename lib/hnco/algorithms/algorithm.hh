@@ -56,6 +56,9 @@ protected:
   /// Function
   function::Function *_function;
 
+  /// Stop token of the first function
+  StopToken *_stop_token = nullptr;
+
   /// Solution
   solution_t _solution;
 
@@ -105,8 +108,12 @@ protected:
 
     _functions = functions;
     _function = functions[0];
+    _stop_token = _function->get_stop_token();
   }
 
+  /// Check whether a stop has been requested
+  bool stop_requested() const { return _stop_token && _stop_token->stop_requested(); }
+
 public:
 
   /// Constructor
@@ -144,6 +151,22 @@ public:
 
   ///@}
 
+  /** @name Statistics
+   */
+  ///@{
+
+  /** Print statistics.
+
+      Prints algorithm-specific statistics as members of a JSON
+      object, each one preceded by a comma and a new line. Does
+      nothing by default.
+
+      \param stream Output stream
+  */
+  virtual void print_statistics(std::ostream& stream) const {}
+
+  ///@}
+
   /// Get bit vector size
   int get_bv_size() const { return _solution.first.size(); }
 
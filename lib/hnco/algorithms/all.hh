@@ -33,6 +33,7 @@
 #include "mimic.hh"
 #include "probability-vector/all.hh"
 #include "random-search.hh"
+#include "steady-state-algorithm.hh"
 #include "walsh-moment/all.hh"
 
 #endif
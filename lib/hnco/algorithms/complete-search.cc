@@ -18,27 +18,215 @@
 
 */
 
+#include <assert.h>
+#include <omp.h>                // omp_get_thread_num
+
+#include <algorithm>            // std::min, std::max
+#include <cstdint>              // std::uint64_t
+
 #include "hnco/exception.hh"
-#include "hnco/iterator.hh"
+#include "hnco/util.hh"         // hnco::is_in_range
 
 #include "complete-search.hh"
 
 using namespace hnco::algorithm;
+using namespace hnco::function;
 using namespace hnco;
 
 
+namespace {
+
+/// Largest number of free bits in a subcube
+const int max_num_free_bits = 20;
+
+/// Number of steps between two full evaluations when evaluating incrementally
+const int resync_period = 256;
+
+/** Bit flipped at a given step of a Gray code.
+
+    It is the number of trailing zeros of the step.
+*/
+inline int
+gray_code_bit(std::uint64_t step)
+{
+  assert(step > 0);
+
+  int i = 0;
+  for (; (step & 1) == 0; step >>= 1)
+    i++;
+  return i;
+}
+
+/// Result of a subcube search
+struct SubcubeResult {
+  /// Best bit vector and its value
+  solution_t best;
+  /// Position of the best bit vector in Gray code order
+  int position;
+};
+
+/** Search a subcube with safe evaluations.
+
+    The subcube is made of all bit vectors whose last n - m bits are
+    given by index (least significant bit first). Only the first
+    num_evaluations bit vectors in Gray code order are evaluated.
+
+    Incremental evaluations are resynchronized with a full evaluation
+    every resync_period steps. The value of a bit vector which
+    improves on the best one is computed with a full evaluation
+    instead, so that the best value is exact. In both cases, there is
+    a single evaluation per bit vector in the batch reported by
+    Function::update_batch.
+
+    \param function Function
+    \param n Bit vector size
+    \param m Number of free bits
+    \param index Index of the subcube
+    \param num_evaluations Number of evaluations
+*/
+SubcubeResult
+search_subcube(Function *function, int n, int m, std::uint64_t index, int num_evaluations)
+{
+  assert(function);
+  assert(0 <= m && m <= n);
+  assert(0 < num_evaluations && num_evaluations <= (1 << m));
+
+  bit_vector_t x(n, 0);
+  for (int i = m; i < n; i++)
+    x[i] = (index >> (i - m)) & 1;
+
+  double value = function->evaluate_safely(x);
+  SubcubeResult result{solution_t(x, value), 0};
+
+  const bool incremental = function->provides_incremental_evaluation();
+  sparse_bit_vector_t flipped_bits(1);
+  for (int step = 1; step < num_evaluations; step++) {
+    const int i = gray_code_bit(step);
+    if (incremental && step % resync_period != 0) {
+      flipped_bits[0] = i;
+      value = function->evaluate_incrementally_safely(x, value, flipped_bits);
+      bv_flip(x, i);
+      if (value > result.best.second)
+        value = function->evaluate_safely(x);
+    } else {
+      bv_flip(x, i);
+      value = function->evaluate_safely(x);
+    }
+    if (value > result.best.second) {
+      result.best.first = x;
+      result.best.second = value;
+      result.position = step;
+    }
+  }
+
+  return result;
+}
+
+}
+
+
 void
-CompleteSearch::maximize(const std::vector<function::Function *>& functions)
+CompleteSearch::search_serially()
 {
-  set_functions(functions);
+  const int n = get_bv_size();
+
+  bit_vector_t x(n, 0);
+  set_solution(x);
+  double value = _solution.second;
+
+  // Each bit vector is counted once. An incremental value is computed
+  // safely then passed to Function::update, unless it improves on the
+  // solution or it is time to resynchronize, in which case the bit
+  // vector is counted through a full evaluation.
+  const bool incremental = _function->provides_incremental_evaluation();
+  sparse_bit_vector_t flipped_bits(1);
+  const std::uint64_t size = std::uint64_t(1) << n;
+  for (std::uint64_t step = 1; step < size; step++) {
+    const int i = gray_code_bit(step);
+    if (incremental && step % resync_period != 0) {
+      flipped_bits[0] = i;
+      value = _function->evaluate_incrementally_safely(x, value, flipped_bits);
+      bv_flip(x, i);
+      if (value > _solution.second)
+        value = _function->evaluate(x);
+      else
+        _function->update(x, value);
+    } else {
+      bv_flip(x, i);
+      value = _function->evaluate(x);
+    }
+    update_solution(x, value);
+  }
+}
+
+void
+CompleteSearch::search_in_parallel()
+{
+  const int n = get_bv_size();
+  const int num_threads = _functions.size();
+  const std::uint64_t round_size = subcubes_per_thread * num_threads;
+
+  // Fix enough bits to give each thread several subcubes per round
+  int num_fixed_bits = std::max(0, n - max_num_free_bits);
+  while (num_fixed_bits < n && (std::uint64_t(1) << num_fixed_bits) < round_size)
+    num_fixed_bits++;
+  const int num_free_bits = n - num_fixed_bits;
+  const std::uint64_t num_subcubes = std::uint64_t(1) << num_fixed_bits;
 
-  HypercubeIterator iterator(get_bv_size());
+  const int subcube_size = 1 << num_free_bits;
 
-  if (!iterator.has_next())
-    throw std::runtime_error("CompleteSearch::maximize: empty hypercube");
+  const std::uint64_t max_round_size = std::min(round_size, num_subcubes);
+  std::vector<SubcubeResult> results(max_round_size);
+  std::vector<int> num_evaluations(max_round_size);
+
+  for (std::uint64_t start = 0; start < num_subcubes; start += max_round_size) {
+    if (stop_requested())
+      return;
+
+    // Reserve evaluations subcube by subcube, the last one being possibly truncated
+    std::uint64_t stop = std::min(start + max_round_size, num_subcubes);
+    for (std::uint64_t index = start; index < stop; index++) {
+      const int granted = _function->reserve_evaluations(subcube_size);
+      assert(0 <= granted && granted <= subcube_size);
+      num_evaluations[index - start] = granted;
+      if (granted < subcube_size) {
+        stop = granted > 0 ? index + 1 : index;
+        break;
+      }
+    }
+
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (std::uint64_t index = start; index < stop; index++) {
+      const int k = omp_get_thread_num();
+      assert(is_in_range(k, _functions.size()));
+      assert(_functions[k]);
+
+      results[index - start] = search_subcube(_functions[k], n, num_free_bits, index, num_evaluations[index - start]);
+    }
+
+    for (std::uint64_t index = start; index < stop; index++) {
+      const SubcubeResult& result = results[index - start];
+      if (index == 0)
+        set_solution(result.best.first, result.best.second);
+      else
+        update_solution(result.best);
+      _function->update_batch(result.best.first, result.best.second, num_evaluations[index - start], result.position);
+      if (stop_requested())
+        return;
+    }
+  }
+}
+
+void
+CompleteSearch::maximize(const std::vector<function::Function *>& functions)
+{
+  set_functions(functions);
 
-  set_solution(iterator.next());
+  if (get_bv_size() >= 64)
+    throw std::runtime_error("CompleteSearch::maximize: bit vector size must be less than 64");
 
-  while (iterator.has_next())
-    update_solution(iterator.next());
+  if (_functions.size() == 1)
+    search_serially();
+  else
+    search_in_parallel();
 }
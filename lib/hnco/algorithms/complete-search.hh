@@ -30,10 +30,46 @@ namespace hnco {
 namespace algorithm {
 
 
-  /// Complete search
+  /** Complete search.
+
+      The hypercube is enumerated in Gray code order so that
+      consecutive bit vectors differ in exactly one bit. Functions
+      which provide incremental evaluation are then evaluated in
+      constant time per bit vector if their incremental evaluation is.
+      To bound the accumulation of rounding errors, incremental
+      evaluations are resynchronized with a full evaluation at regular
+      intervals. A bit vector whose incremental value improves on the
+      best one is evaluated in full instead, hence the best bit vector
+      is always reported with its exact value. Every bit vector is
+      counted once by function controllers: in serial mode, either
+      through its full evaluation or through Function::update after a
+      safe incremental evaluation.
+
+      If more than one function is given, the hypercube is split into
+      subcubes obtained by fixing the last bits. Subcubes are searched
+      in parallel, one function per thread, with safe evaluations
+      (see Function::evaluate_safely and
+      Function::evaluate_incrementally_safely). Before each round of
+      subcubes, evaluations are reserved on the first function (see
+      Function::reserve_evaluations) and the last granted subcube is
+      possibly truncated. After each round, the best bit vector of
+      each subcube is passed to the first function through
+      Function::update_batch so that function controllers such as
+      OnBudgetFunction and ProgressTracker account for all the
+      evaluations of the subcube.
+  */
   class CompleteSearch:
     public Algorithm {
 
+    /// Number of subcubes per thread and per round
+    static constexpr int subcubes_per_thread = 4;
+
+    /// Search the whole hypercube with a single function
+    void search_serially();
+
+    /// Search subcubes in parallel
+    void search_in_parallel();
+
   public:
 
     /// Constructor
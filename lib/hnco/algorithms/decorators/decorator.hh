@@ -50,7 +50,10 @@ public:
     : Algorithm(algorithm->get_bv_size())
     , _algorithm(algorithm)
   {}
-    
+
+  /// Print the statistics of the decorated algorithm
+  void print_statistics(std::ostream& stream) const override { _algorithm->print_statistics(stream); }
+
 };
 
 
@@ -43,10 +43,14 @@ Restart::maximize(const std::vector<function::Function *>& functions)
   if (_num_iterations > 0) {
     for (int i = 0; i < _num_iterations; i++) {
       iterate(i == 0);
+      if (stop_requested())
+        break;
     }
   } else {
     for (int i = 0;; i++) {
       iterate(i == 0);
+      if (stop_requested())
+        break;
     }
   }
 }
@@ -0,0 +1,107 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <omp.h>                // omp_get_thread_num
+
+#include <algorithm>            // std::fill
+#include <limits>               // std::numeric_limits
+
+#include "delta-population.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::function;
+using namespace hnco;
+
+void
+DeltaPopulation::load(int i, int previous, const Population& population)
+{
+  if (previous >= 0 && parents[previous] == parents[i]) {
+    bv_flip(_bv, flipped_bits[previous]);
+    bv_flip(_bv, flipped_bits[i]);
+  } else
+    materialize(i, population, _bv);
+}
+
+void
+DeltaPopulation::evaluate(const Population& population, Function *function)
+{
+  assert(have_same_size(parents, values));
+  assert(function);
+
+  const StopToken *token = function->get_stop_token();
+  const bool incremental = function->provides_incremental_evaluation();
+
+  for (size_t i = 0; i < parents.size(); i++) {
+    if (token && token->stop_requested()) {
+      std::fill(values.begin() + i, values.end(), -std::numeric_limits<double>::infinity());
+      break;
+    }
+    if (incremental) {
+      const int p = parents[i];
+      values[i] = function->evaluate_incrementally(population.bvs[p], population.values[p], flipped_bits[i]);
+    } else {
+      load(i, int(i) - 1, population);
+      values[i] = function->evaluate(_bv);
+    }
+  }
+}
+
+void
+DeltaPopulation::evaluate_in_parallel(const Population& population, const std::vector<Function *>& fns)
+{
+  assert(have_same_size(parents, values));
+  assert(!fns.empty());
+
+  const StopToken *token = fns[0]->get_stop_token();
+  const bool incremental = fns[0]->provides_incremental_evaluation();
+  if (!incremental)
+    _bvs.resize(fns.size(), _bv);
+
+  const int size = parents.size();
+  const int num_reserved = fns[0]->reserve_evaluations(size);
+  const int num_threads = fns.size();
+
+#pragma omp parallel for num_threads(num_threads)
+  for (int i = 0; i < num_reserved; i++) {
+    int k = omp_get_thread_num();
+    assert(is_in_range(k, fns.size()));
+    assert(fns[k]);
+
+    if (token && token->stop_requested())
+      continue;
+
+    const int p = parents[i];
+    if (incremental)
+      values[i] = fns[k]->evaluate_incrementally_safely(population.bvs[p], population.values[p], flipped_bits[i]);
+    else {
+      materialize(i, population, _bvs[k]);
+      values[i] = fns[k]->evaluate_safely(_bvs[k]);
+    }
+  }
+
+  int i = 0;
+  for (; i < num_reserved; i++) {
+    if (token && token->stop_requested())
+      break;
+    load(i, i - 1, population);
+    fns[0]->update(_bv, values[i]);
+  }
+  std::fill(values.begin() + i, values.end(), -std::numeric_limits<double>::infinity());
+}
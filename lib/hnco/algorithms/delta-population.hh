@@ -0,0 +1,191 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef HNCO_ALGORITHMS_DELTA_POPULATION_H
+#define HNCO_ALGORITHMS_DELTA_POPULATION_H
+
+#include <algorithm>            // std::sort, std::partial_sort
+#include <cassert>
+#include <vector>
+
+#include "hnco/bit-vector.hh"
+#include "hnco/functions/function.hh"
+#include "hnco/permutation.hh"
+#include "hnco/sparse-bit-vector.hh"
+#include "hnco/util.hh"         // hnco::ensure, hnco::is_in_range
+
+#include "population.hh"
+
+namespace hnco {
+namespace algorithm {
+
+/**
+ * Delta-encoded population. Each individual is represented by the
+ * index of its parent in a parent population and the bits in which
+ * it differs from its parent. Individuals are evaluated
+ * incrementally against the value of their parent whenever the
+ * function provides incremental evaluation, and only materialized
+ * into full bit vectors when needed, e.g. when they survive
+ * selection.
+ */
+struct DeltaPopulation {
+  /// %Function type
+  using Function = hnco::function::Function;
+  /// Parent indices
+  std::vector<int> parents;
+  /// Flipped bits
+  std::vector<sparse_bit_vector_t> flipped_bits;
+  /// Values
+  std::vector<double> values;
+  /// Permutation
+  hnco::permutation_t permutation;
+
+  /**
+   * Constructor.
+   * @param size Population size
+   * @param n Bit vector size
+   */
+  DeltaPopulation(int size, int n)
+    : parents(size)
+    , flipped_bits(size)
+    , values(size)
+    , permutation(size)
+    , _bv(n)
+  {
+    ensure(size > 0, "DeltaPopulation::DeltaPopulation: population size must be positive");
+    ensure(n > 0, "DeltaPopulation::DeltaPopulation: bit vector size must be positive");
+    perm_identity(permutation);
+  }
+
+  /**
+   * @name Properties
+   */
+  ///@{
+  /// Get population size
+  int get_size() const { return parents.size(); }
+  /// Get bit vector size
+  int get_bv_size() const { return _bv.size(); }
+  ///@}
+
+  /**
+   * Materialize an individual.
+   * @param i Index of the individual
+   * @param population Parent population
+   * @param bv Output bit vector
+   */
+  void materialize(int i, const Population& population, bit_vector_t& bv) const {
+    assert(is_in_range(i, get_size()));
+    assert(is_in_range(parents[i], population.get_size()));
+    bv = population.bvs[parents[i]];
+    bv_flip(bv, flipped_bits[i]);
+  }
+
+  /**
+   * @name Evaluation and sorting
+   */
+  ///@{
+  /**
+   * Evaluate the population.
+   * If a stop is requested on the stop token of the function, the
+   * remaining offsprings are not evaluated and their values are set
+   * to -infinity.
+   * @param population Parent population, which must have been evaluated
+   * @param function Function
+   */
+  void evaluate(const Population& population, Function *function);
+  /**
+   * Evaluate the population in parallel.
+   * Evaluations are reserved on the first function before being
+   * dispatched. Offsprings beyond the granted evaluations are not
+   * evaluated and their values are set to -infinity. Same behavior
+   * as evaluate if a stop is requested on the stop token of the
+   * first function.
+   * @param population Parent population, which must have been evaluated
+   * @param functions Functions, one per thread (one thread is used per function)
+   */
+  void evaluate_in_parallel(const Population& population, const std::vector<Function *>& functions);
+  /**
+   * Sort the population. Only the permutation is sorted using the
+   * order defined by i < j if values[i] > values[j]. Before sorting,
+   * the permutation is shuffled to break ties randomly.
+   */
+  void sort() {
+    perm_shuffle(permutation);
+    auto compare = [this](int i, int j){ return values[i] > values[j]; };
+    std::sort(permutation.begin(), permutation.end(), compare);
+  }
+  /**
+   * Partially sort the population. Only the permutation is sorted
+   * using the order defined by i < j if values[i] > values[j]. Before
+   * sorting, the permutation is shuffled to break ties randomly.
+   * @param selection_size Sort the best selection_size individuals
+   */
+  void partial_sort(int selection_size) {
+    assert(selection_size > 0);
+    perm_shuffle(permutation);
+    auto compare = [this](int i, int j){ return values[i] > values[j]; };
+    std::partial_sort(permutation.begin(), permutation.begin() + selection_size, permutation.end(), compare);
+  }
+  ///@}
+
+  /**
+   * @name Get sorted values and indices
+   */
+  ///@{
+  /**
+   * Get best value.
+   * @param i Index in the sorted population
+   * @pre The population must be sorted.
+   */
+  double get_best_value(int i) const {
+    assert(hnco::is_in_range(i, permutation.size()));
+    return values[permutation[i]];
+  }
+  /**
+   * Get best index.
+   * @param i Index in the sorted population
+   * @pre The population must be sorted.
+   */
+  int get_best_index(int i) const {
+    assert(hnco::is_in_range(i, permutation.size()));
+    return permutation[i];
+  }
+  ///@}
+
+private:
+  /// Bit vector used for non incremental evaluation and updates
+  bit_vector_t _bv;
+  /// Bit vectors used for parallel non incremental evaluation
+  std::vector<bit_vector_t> _bvs;
+  /**
+   * Materialize an individual into _bv. If the previous individual
+   * has the same parent, only flipped bits are restored and flipped
+   * instead of copying the whole parent.
+   * @param i Index of the individual
+   * @param previous Index of the individual currently held in _bv or -1
+   * @param population Parent population
+   */
+  void load(int i, int previous, const Population& population);
+};
+
+}
+}
+
+#endif
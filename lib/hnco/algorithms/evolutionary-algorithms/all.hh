@@ -25,11 +25,14 @@
 #include "it-ea.hh"
 #include "mu-comma-lambda-ea.hh"
 #include "mu-plus-lambda-ea.hh"
+#include "mu-plus-one-ea.hh"
 #include "one-plus-lambda-comma-lambda-ga.hh"
 #include "one-plus-one-ea.hh"
+#include "parallel-reproduction.hh"
 #include "random-selection.hh"
 #include "selection.hh"
 #include "self-adjusting-one-plus-one-ea.hh"
+#include "steady-state-ga.hh"
 #include "two-rate-one-plus-lambda-ea.hh"
 
 #endif
@@ -18,6 +18,11 @@
 
 */
 
+#include <stdint.h>             // uint32_t, uint64_t
+#include <string.h>             // std::memcpy
+
+#include <array>
+
 #include "crossover.hh"
 
 
@@ -26,6 +31,58 @@ using namespace hnco::random;
 using namespace hnco;
 
 
+namespace {
+
+/** Byte masks.
+
+    Byte i of masks[k] is 0xff if bit i of k is set, 0x00 otherwise.
+*/
+const std::array<uint64_t, 256> masks = []() {
+  std::array<uint64_t, 256> result{};
+  for (int k = 0; k < 256; k++)
+    for (int i = 0; i < 8; i++)
+      if ((k >> i) & 1)
+        result[k] |= uint64_t(0xff) << (8 * i);
+  return result;
+}();
+
+/** Uniform blend.
+
+    Each bit of the offspring is copied from the first parent if the
+    corresponding random bit is set, from the second parent
+    otherwise.
+*/
+void
+blend_uniformly(const bit_vector_t& parent1, const bit_vector_t& parent2, bit_vector_t& offspring,
+                std::mt19937& engine)
+{
+  const size_t n = offspring.size();
+  const uint8_t *p1 = parent1.data();
+  const uint8_t *p2 = parent2.data();
+  uint8_t *q = offspring.data();
+
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    uint32_t bits = engine();
+    for (size_t j = i; j < i + 32; j += 8, bits >>= 8) {
+      const uint64_t mask = masks[bits & 0xff];
+      uint64_t w1, w2;
+      memcpy(&w1, p1 + j, sizeof w1);
+      memcpy(&w2, p2 + j, sizeof w2);
+      const uint64_t w = (w1 & mask) | (w2 & ~mask);
+      memcpy(q + j, &w, sizeof w);
+    }
+  }
+  if (i < n) {
+    uint32_t bits = engine();
+    for (; i < n; i++, bits >>= 1)
+      q[i] = (bits & 1) ? p1[i] : p2[i];
+  }
+}
+
+}
+
+
 void
 UniformCrossover::recombine(const bit_vector_t& parent1,
                             const bit_vector_t& parent2, bit_vector_t& offspring)
@@ -33,11 +90,7 @@ UniformCrossover::recombine(const bit_vector_t& parent1,
   assert(offspring.size() == parent1.size());
   assert(offspring.size() == parent2.size());
 
-  for (size_t i = 0; i < offspring.size(); i++)
-    if (Generator::bernoulli())
-      offspring[i] = parent1[i];
-    else
-      offspring[i] = parent2[i];
+  blend_uniformly(parent1, parent2, offspring, *_engine);
 }
 
 
@@ -48,9 +101,30 @@ BiasedCrossover::recombine(const bit_vector_t& parent1,
   assert(offspring.size() == parent1.size());
   assert(offspring.size() == parent2.size());
 
+  if (_bias == 0.5) {
+    blend_uniformly(parent1, parent2, offspring, *_engine);
+    return;
+  }
+
+  const bit_vector_t& base = _bias < 0.5 ? parent1 : parent2;
+  const bit_vector_t& patch = _bias < 0.5 ? parent2 : parent1;
+
+  // Skipping cannot be done in place in the least likely parent
+  if (std::min(_bias, 1 - _bias) < skipping_threshold && &offspring != &patch) {
+    // Copy the most likely parent then patch with the other one
+    if (&offspring != &base)
+      offspring = base;
+    // Keep the position in a double, skips are unbounded
+    const double n = offspring.size();
+    double index = Generator::geometric(_log_q, *_engine);
+    while (index < n) {
+      const size_t i = index;
+      offspring[i] = patch[i];
+      index += 1 + Generator::geometric(_log_q, *_engine);
+    }
+    return;
+  }
+
   for (size_t i = 0; i < offspring.size(); i++)
-    if (_bernoulli_dist(Generator::engine))
-      offspring[i] = parent2[i];
-    else
-      offspring[i] = parent1[i];
+    offspring[i] = (*_engine)() < _threshold ? parent2[i] : parent1[i];
 }
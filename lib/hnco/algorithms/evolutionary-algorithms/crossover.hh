@@ -22,6 +22,10 @@
 #define HNCO_ALGORITHMS_EA_CROSSOVER_H
 
 #include <assert.h>
+#include <math.h>               // std::log1p, std::ldexp
+#include <stdint.h>             // uint32_t
+
+#include <algorithm>            // std::min
 
 #include "hnco/bit-vector.hh"
 #include "hnco/random.hh"
@@ -34,11 +38,24 @@ namespace algorithm {
 /// %Crossover
 class Crossover {
 
+protected:
+
+  /// Random engine
+  std::mt19937 *_engine = &random::Generator::engine;
+
 public:
 
   /// Destructor
   virtual ~Crossover() {}
 
+  /** Set the random engine.
+
+      By default, random::Generator::engine is used. A thread-local
+      copy of the crossover operator should draw from a thread-local
+      engine.
+  */
+  void set_engine(std::mt19937 *engine) { _engine = engine; }
+
   /** Recombine.
 
       The offspring is the crossover of two parents.
@@ -52,7 +69,12 @@ public:
 };
 
 
-/// Uniform crossover
+/** Uniform crossover.
+
+    Each 32-bit word drawn from the random engine decides the origin
+    of 32 consecutive bits, which are blended eight at a time with
+    byte masks.
+*/
 class UniformCrossover:
     public Crossover {
 
@@ -71,18 +93,35 @@ public:
 };
 
 
-/// Biased crossover
+/** Biased crossover.
+
+    If the bias is equal to 1/2, the offspring is sampled as in
+    uniform crossover. If the bias or its complement is less than
+    skipping_threshold, the offspring is a copy of the most likely
+    parent and the bits to take from the other parent are reached
+    with geometric skips, so that the number of random draws is
+    proportional to the expected number of such bits. Otherwise, one
+    32-bit random word is drawn per bit and compared to a threshold.
+*/
 class BiasedCrossover:
     public Crossover {
 
-  /// Bernoulli distribution
-  std::bernoulli_distribution _bernoulli_dist;
+  /// Threshold on 32-bit random words below which a bit is taken from the second parent
+  uint32_t _threshold;
+
+  /// Bias
+  double _bias;
+
+  /// Logarithm of the probability of taking a bit from the most likely parent
+  double _log_q;
 
 public:
 
+  /// Bias below which geometric skipping is used
+  static constexpr double skipping_threshold = 0.25;
+
   /// Constructor
-  BiasedCrossover():
-    _bernoulli_dist(0.5) {}
+  BiasedCrossover() { set_bias(0.5); }
 
   /** Recombine.
 
@@ -100,7 +139,9 @@ public:
     assert(b > 0);
     assert(b < 1);
 
-    _bernoulli_dist = std::bernoulli_distribution(b);
+    _threshold = uint32_t(std::ldexp(b, 32));
+    _bias = b;
+    _log_q = std::log1p(-std::min(b, 1 - b));
   }
 
 };
@@ -38,6 +38,9 @@ GeneticAlgorithm::init()
   _mutation.set_mutation_rate(_mutation_rate);
   _mutation.set_allow_no_mutation(_allow_no_mutation);
 
+  if (_functions.size() > 1)
+    _parallel_reproduction.init(_functions.size(), _tournament_selection, _mutation, _crossover);
+
   _parents.random();
   _parents.evaluate(_function);
   _parents.sort();
@@ -49,6 +52,24 @@ GeneticAlgorithm::init()
 
 void
 GeneticAlgorithm::iterate()
+{
+  if (_functions.size() > 1) {
+    _parallel_reproduction.generate(_offsprings.bvs, _crossover_probability);
+    _offsprings.evaluate_in_parallel(_functions);
+  } else {
+    generate_offsprings();
+    _offsprings.evaluate(_function);
+  }
+
+  _comma_selection.select();
+
+  update_solution(_parents.get_best_bv(),
+                  _parents.get_best_value());
+}
+
+
+void
+GeneticAlgorithm::generate_offsprings()
 {
   for (int i = 0; i < _offsprings.get_size(); i++) {
     auto& offspring = _offsprings.bvs[i];
@@ -62,14 +83,5 @@ GeneticAlgorithm::iterate()
     // Mutation
     _mutation.mutate(offspring);
   }
-
-  if (_functions.size() > 1)
-    _offsprings.evaluate_in_parallel(_functions);
-  else
-    _offsprings.evaluate(_function);
-
-  _comma_selection.select();
-
-  update_solution(_parents.get_best_bv(),
-                  _parents.get_best_value());
 }
+
@@ -29,6 +29,7 @@
 #include "hnco/random.hh"
 
 #include "crossover.hh"
+#include "parallel-reproduction.hh"
 #include "random-selection.hh"
 #include "selection.hh"
 
@@ -44,6 +45,10 @@ namespace algorithm {
     - Standard bit mutation
     - (mu, mu) selection (offspring population replaces parent population)
 
+    If several functions are given to maximize, offsprings are
+    generated in parallel (see ParallelReproduction). Results only
+    depend on the seed and the number of threads.
+
     Reference:
 
     J. H. Holland. 1975. Adaptation in natural and artificial
@@ -75,6 +80,9 @@ protected:
   /// Uniform crossover
   UniformCrossover _crossover;
 
+  /// Parallel reproduction
+  ParallelReproduction<TournamentSelection> _parallel_reproduction;
+
   /** @name Parameters
    */
   ///@{
@@ -105,6 +113,9 @@ protected:
 
   ///@}
 
+  /// Generate offsprings
+  void generate_offsprings();
+
 public:
 
   /** Constructor.
@@ -34,12 +34,14 @@ MuCommaLambdaEa::init()
   _mutation.set_mutation_rate(_mutation_rate);
   _mutation.set_allow_no_mutation(_allow_no_mutation);
 
+  // Parents are evaluated since offsprings are evaluated
+  // incrementally with respect to them.
   _parents.random();
+  _parents.evaluate(_function);
+  _parents.sort();
 
-  // There is no need to evaluate them as they are going to be
-  // replaced by offsprings.
-
-  random_solution();
+  set_solution(_parents.get_best_bv(),
+               _parents.get_best_value());
 }
 
 
@@ -47,15 +49,15 @@ void
 MuCommaLambdaEa::iterate()
 {
   for (int i = 0; i < _offsprings.get_size(); i++) {
-    auto& offspring = _offsprings.bvs[i];
-    offspring = _parents.bvs[_select_parent(Generator::engine)];
-    _mutation.mutate(offspring);
+    _offsprings.parents[i] = _select_parent(Generator::engine);
+    _mutation.sample_flipped_bits();
+    _offsprings.flipped_bits[i] = _mutation.get_flipped_bits();
   }
 
   if (_functions.size() > 1)
-    _offsprings.evaluate_in_parallel(_functions);
+    _offsprings.evaluate_in_parallel(_parents, _functions);
   else
-    _offsprings.evaluate(_function);
+    _offsprings.evaluate(_parents, _function);
 
   _comma_selection.select();
 
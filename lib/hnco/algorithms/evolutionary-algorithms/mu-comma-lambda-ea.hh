@@ -21,6 +21,7 @@
 #ifndef HNCO_ALGORITHMS_EA_MU_COMMA_LAMBDA_H
 #define HNCO_ALGORITHMS_EA_MU_COMMA_LAMBDA_H
 
+#include "hnco/algorithms/delta-population.hh"
 #include "hnco/algorithms/iterative-algorithm.hh"
 #include "hnco/algorithms/population.hh"
 #include "hnco/neighborhoods/neighborhood.hh"
@@ -39,6 +40,11 @@ namespace algorithm {
 
     Thomas Jansen, Analyzing Evolutionary Algorithms. Springer, 2013.
 
+    Offsprings are delta-encoded, that is represented by their parent
+    and the bits flipped by the mutation. They are evaluated
+    incrementally if the function provides incremental evaluation
+    and materialized only when selected.
+
 */
 class MuCommaLambdaEa: public IterativeAlgorithm {
 
@@ -48,10 +54,10 @@ protected:
   Population _parents;
 
   /// Offsprings
-  Population _offsprings;
+  DeltaPopulation _offsprings;
 
   /// Comma selection
-  CommaSelection _comma_selection;
+  DeltaCommaSelection _comma_selection;
 
   /// Mutation operator
   neighborhood::StandardBitMutation _mutation;
@@ -47,15 +47,15 @@ void
 MuPlusLambdaEa::iterate()
 {
   for (int i = 0; i < _offsprings.get_size(); i++) {
-    auto& offspring = _offsprings.bvs[i];
-    offspring = _parents.bvs[_select_parent(Generator::engine)];
-    _mutation.mutate(offspring);
+    _offsprings.parents[i] = _select_parent(Generator::engine);
+    _mutation.sample_flipped_bits();
+    _offsprings.flipped_bits[i] = _mutation.get_flipped_bits();
   }
 
   if (_functions.size() > 1)
-    _offsprings.evaluate_in_parallel(_functions);
+    _offsprings.evaluate_in_parallel(_parents, _functions);
   else
-    _offsprings.evaluate(_function);
+    _offsprings.evaluate(_parents, _function);
 
   _plus_selection.select();
 
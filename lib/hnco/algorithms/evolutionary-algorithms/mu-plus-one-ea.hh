@@ -0,0 +1,126 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef HNCO_ALGORITHMS_EA_MU_PLUS_ONE_EA_H
+#define HNCO_ALGORITHMS_EA_MU_PLUS_ONE_EA_H
+
+#include <random>
+
+#include "hnco/algorithms/population.hh"
+#include "hnco/algorithms/steady-state-algorithm.hh"
+#include "hnco/neighborhoods/neighborhood.hh"
+
+
+namespace hnco {
+namespace algorithm {
+
+
+/** (mu+1) EA.
+
+    At each step, a parent is uniformly selected in the population and
+    mutated. The offspring replaces a worst individual of the
+    population if its value is greater than or equal to the value of
+    the latter.
+
+    If several functions are given to maximize, offsprings are
+    evaluated asynchronously (see SteadyStateAlgorithm).
+
+    Reference:
+
+    Carsten Witt, Runtime Analysis of the (mu+1) EA on Simple
+    Pseudo-Boolean Functions. Evolutionary Computation 14(1), 2006.
+
+*/
+class MuPlusOneEa: public SteadyStateAlgorithm {
+
+protected:
+
+  /// Population
+  Population _population;
+
+  /// Mutation operator
+  neighborhood::StandardBitMutation _mutation;
+
+  /// Select parent
+  std::uniform_int_distribution<int> _select_parent;
+
+  /// Index of a worst individual
+  int _worst;
+
+  /** @name Parameters
+   */
+  ///@{
+
+  /// Mutation rate
+  double _mutation_rate;
+
+  /// Allow no mutation
+  bool _allow_no_mutation = false;
+
+  ///@}
+
+  /// Initialize
+  void init() override;
+
+  /** @name Steady state
+   */
+  ///@{
+
+  /// Generate a candidate
+  void generate(bit_vector_t& candidate) override;
+
+  /// Integrate an evaluated candidate
+  void integrate(const bit_vector_t& candidate, double value) override;
+
+  ///@}
+
+public:
+
+  /** Constructor.
+
+      \param n Size of bit vectors
+      \param mu %Population size
+  */
+  MuPlusOneEa(int n, int mu):
+    SteadyStateAlgorithm(n),
+    _population(mu, n),
+    _mutation(n),
+    _select_parent(0, mu - 1),
+    _mutation_rate(1 / double(n)) {}
+
+  /** @name Setters
+   */
+  ///@{
+
+  /// Set the mutation rate
+  void set_mutation_rate(double p) { _mutation_rate = p; }
+
+  /// Set the flag _allow_no_mutation
+  void set_allow_no_mutation(bool b) { _allow_no_mutation = b; }
+
+  ///@}
+
+};
+
+
+} // end of namespace algorithm
+} // end of namespace hnco
+
+
+#endif
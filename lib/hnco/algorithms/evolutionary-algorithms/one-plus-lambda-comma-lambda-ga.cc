@@ -18,6 +18,11 @@
 
 */
 
+#include <omp.h>                // omp_get_thread_num
+
+#include <algorithm>            // std::sort
+#include <limits>               // std::numeric_limits
+
 #include "one-plus-lambda-comma-lambda-ga.hh"
 
 
@@ -31,7 +36,10 @@ void
 OnePlusLambdaCommaLambdaGa::init()
 {
   _radius_dist = std::binomial_distribution<int>(_parent.size(), _mutation_rate);
-  _crossover.set_bias(_crossover_bias);
+  _crossover_dist = std::bernoulli_distribution(_crossover_bias);
+  _incremental = _function->provides_incremental_evaluation();
+  _num_skipped_evaluations = 0;
+  _num_incremental_evaluations = 0;
 
   random_solution();
 }
@@ -40,34 +48,49 @@ OnePlusLambdaCommaLambdaGa::init()
 void
 OnePlusLambdaCommaLambdaGa::iterate()
 {
+  const int lambda = _offsprings.get_size();
+
   // Mutation
   _mutation.set_radius(_radius_dist(Generator::engine));
-  for (int i = 0; i < _offsprings.get_size(); i++) {
-    auto& offspring = _offsprings.bvs[i];
-    _mutation.map(_solution.first, offspring);
+  for (int i = 0; i < lambda; i++) {
+    _mutation.map(_solution.first, _offsprings.bvs[i]);
+    _flipped_bits[i] = _mutation.get_flipped_bits();
   }
-  _offsprings.evaluate(_function);
+  evaluate_offsprings(sparse_bit_vector_t(), _solution.second);
+  if (stop_requested())
+    return;
   _offsprings.sort();
 
   double value = _offsprings.get_best_value(0);
   int n = 0;
-  while (_offsprings.get_best_value(n) == value && n < _offsprings.get_size())
+  while (n < _offsprings.get_size() && _offsprings.get_best_value(n) == value)
     n++;
   assert(n > 0);
   std::uniform_int_distribution<int> choose_parent(0, n - 1);
-  _parent = _offsprings.get_best_bv(choose_parent(Generator::engine));
+  const int index = _offsprings.get_best_index(choose_parent(Generator::engine));
+  _parent = _offsprings.bvs[index];
+  _parent_flipped_bits = _flipped_bits[index];
+  const double parent_value = _offsprings.values[index];
 
   // Crossover
-  for (int i = 0; i < _offsprings.get_size(); i++)
-    _crossover.recombine(_solution.first, _parent, _offsprings.bvs[i]);
-  _offsprings.evaluate(_function);
+  for (int i = 0; i < lambda; i++) {
+    auto& flipped_bits = _flipped_bits[i];
+    flipped_bits.clear();
+    for (int j : _parent_flipped_bits)
+      if (_crossover_dist(Generator::engine))
+        flipped_bits.push_back(j);
+    auto& offspring = _offsprings.bvs[i];
+    offspring = _solution.first;
+    bv_flip(offspring, flipped_bits);
+  }
+  evaluate_offsprings(_parent_flipped_bits, parent_value);
   _offsprings.sort();
 
   // Selection
   value = _offsprings.get_best_value(0);
   if (value >= _solution.second) {
     n = 0;
-    while (_offsprings.get_best_value(n) == value && n < _offsprings.get_size())
+    while (n < _offsprings.get_size() && _offsprings.get_best_value(n) == value)
       n++;
     assert(n > 0);
     choose_parent = std::uniform_int_distribution<int>(0, n - 1);
@@ -77,3 +100,89 @@ OnePlusLambdaCommaLambdaGa::iterate()
   }
 
 }
+
+
+void
+OnePlusLambdaCommaLambdaGa::evaluate_offsprings(const sparse_bit_vector_t& known_bits, double known_value)
+{
+  const int lambda = _offsprings.get_size();
+  auto& values = _offsprings.values;
+
+  // Sorting brings identical offsprings together
+  perm_identity(_order);
+  std::sort(_order.begin(), _order.end(),
+            [this](int i, int j) { return _flipped_bits[i] < _flipped_bits[j]; });
+
+  _pending.clear();
+  for (int k = 0; k < lambda; k++) {
+    const int i = _order[k];
+    const auto& flipped_bits = _flipped_bits[i];
+    if (flipped_bits.empty()) {
+      _sources[i] = -1;
+      values[i] = _solution.second;
+    } else if (flipped_bits == known_bits) {
+      _sources[i] = -1;
+      values[i] = known_value;
+    } else if (k > 0 && flipped_bits == _flipped_bits[_order[k - 1]]) {
+      _sources[i] = _sources[_order[k - 1]];
+    } else {
+      _sources[i] = i;
+      _pending.push_back(i);
+    }
+  }
+  const int num_pending = _pending.size();
+  _num_skipped_evaluations += lambda - num_pending;
+
+  int num_evaluations = num_pending;
+  if (_functions.size() > 1) {
+    const int num_reserved = _function->reserve_evaluations(num_pending);
+    const int num_threads = _functions.size();
+#pragma omp parallel for num_threads(num_threads)
+    for (int k = 0; k < num_reserved; k++) {
+      if (stop_requested())
+        continue;
+      const int i = _pending[k];
+      Function *function = _functions[omp_get_thread_num()];
+      if (_incremental)
+        values[i] = function->evaluate_incrementally_safely(_solution.first, _solution.second, _flipped_bits[i]);
+      else
+        values[i] = function->evaluate_safely(_offsprings.bvs[i]);
+    }
+    for (int k = 0; k < num_pending; k++) {
+      if (k == num_reserved || stop_requested()) {
+        skip_pending(k);
+        num_evaluations = k;
+        break;
+      }
+      const int i = _pending[k];
+      _function->update(_offsprings.bvs[i], values[i]);
+    }
+  } else {
+    for (int k = 0; k < num_pending; k++) {
+      if (stop_requested()) {
+        skip_pending(k);
+        num_evaluations = k;
+        break;
+      }
+      const int i = _pending[k];
+      if (_incremental)
+        values[i] = _function->evaluate_incrementally(_solution.first, _solution.second, _flipped_bits[i]);
+      else
+        values[i] = _function->evaluate(_offsprings.bvs[i]);
+    }
+  }
+  if (_incremental)
+    _num_incremental_evaluations += num_evaluations;
+
+  for (int i = 0; i < lambda; i++)
+    if (_sources[i] >= 0 && _sources[i] != i)
+      values[i] = values[_sources[i]];
+}
+
+
+void
+OnePlusLambdaCommaLambdaGa::skip_pending(int k)
+{
+  for (; k < int(_pending.size()); k++)
+    _offsprings.values[_pending[k]] = -std::numeric_limits<double>::infinity();
+}
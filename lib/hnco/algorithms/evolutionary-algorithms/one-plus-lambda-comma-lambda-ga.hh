@@ -28,9 +28,9 @@
 #include "hnco/algorithms/iterative-algorithm.hh"
 #include "hnco/algorithms/population.hh"
 #include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/permutation.hh"
 #include "hnco/random.hh"
-
-#include "crossover.hh"
+#include "hnco/sparse-bit-vector.hh"
 
 
 namespace hnco {
@@ -45,6 +45,19 @@ namespace algorithm {
     black-box complexity to designing new genetic
     algorithms. Theoretical Computer Science 567 (2015), 87–104.
 
+    Every offspring, be it a mutant or a crossover child, is
+    represented by the set of bits in which it differs from the
+    current solution. Crossover children are sampled directly as
+    subsets of the flipped bits of the selected mutant, which is
+    equivalent to biased crossover between the solution and the
+    mutant.
+
+    Offsprings identical to the current solution, to the selected
+    mutant, or to another offspring of the same phase are not
+    evaluated. The other ones are evaluated incrementally if the
+    function provides incremental evaluation, and in parallel if
+    several functions are given to maximize.
+
 */
 class OnePlusLambdaCommaLambdaGa: public IterativeAlgorithm {
 
@@ -62,8 +75,37 @@ protected:
   /// Parent
   bit_vector_t _parent;
 
-  /// Biased crossover
-  BiasedCrossover _crossover;
+  /// Bits flipped in each offspring with respect to the solution
+  std::vector<sparse_bit_vector_t> _flipped_bits;
+
+  /// Bits flipped in the parent with respect to the solution
+  sparse_bit_vector_t _parent_flipped_bits;
+
+  /** Sources.
+
+      _sources[i] is the index of the offspring evaluated in place of
+      offspring i, or -1 if offspring i is identical to a point whose
+      value is already known.
+  */
+  std::vector<int> _sources;
+
+  /// Offsprings sorted by flipped bits
+  permutation_t _order;
+
+  /// Indices of the offsprings to evaluate
+  std::vector<int> _pending;
+
+  /// Crossover distribution
+  std::bernoulli_distribution _crossover_dist;
+
+  /// Use incremental evaluation
+  bool _incremental;
+
+  /// Number of skipped evaluations
+  long _num_skipped_evaluations = 0;
+
+  /// Number of incremental evaluations
+  long _num_incremental_evaluations = 0;
 
   /** @name Parameters
    */
@@ -89,6 +131,27 @@ protected:
 
   ///@}
 
+  /** Evaluate offsprings.
+
+      Offsprings without flipped bits take the value of the solution
+      and those whose flipped bits are equal to known_bits take
+      known_value. Among identical offsprings, only the first one is
+      evaluated. In parallel, evaluations are reserved on the first
+      function before being dispatched. If a stop is requested or
+      evaluations are not granted, the remaining offsprings are not
+      evaluated and their values are set to -infinity.
+
+      \param known_bits Flipped bits of a point with known value
+      \param known_value Value of this point
+  */
+  void evaluate_offsprings(const sparse_bit_vector_t& known_bits, double known_value);
+
+  /** Skip pending evaluations.
+
+      \param k Index of the first skipped offspring in _pending
+  */
+  void skip_pending(int k);
+
 public:
 
   /** Constructor.
@@ -103,7 +166,10 @@ public:
     IterativeAlgorithm(n),
     _offsprings(lambda, n),
     _mutation(n, 1),
-    _parent(n)
+    _parent(n),
+    _flipped_bits(lambda),
+    _sources(lambda),
+    _order(lambda)
   {
     assert(n > 0);
     assert(lambda > 0);
@@ -125,6 +191,25 @@ public:
 
   ///@}
 
+  /** @name Statistics
+   */
+  ///@{
+
+  /// Get the number of offsprings which have not been evaluated
+  long get_num_skipped_evaluations() const { return _num_skipped_evaluations; }
+
+  /// Get the number of offsprings which have been evaluated incrementally
+  long get_num_incremental_evaluations() const { return _num_incremental_evaluations; }
+
+  /// Print the numbers of skipped and incremental evaluations
+  void print_statistics(std::ostream& stream) const override {
+    stream
+      << ",\n  \"num_skipped_evaluations\": "     << _num_skipped_evaluations
+      << ",\n  \"num_incremental_evaluations\": " << _num_incremental_evaluations;
+  }
+
+  ///@}
+
 };
 
 
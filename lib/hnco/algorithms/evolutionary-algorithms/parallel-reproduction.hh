@@ -0,0 +1,143 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef HNCO_ALGORITHMS_EA_PARALLEL_REPRODUCTION_H
+#define HNCO_ALGORITHMS_EA_PARALLEL_REPRODUCTION_H
+
+#include <assert.h>
+#include <omp.h>                // omp_get_thread_num
+
+#include <random>
+#include <vector>
+
+#include "hnco/bit-vector.hh"
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+#include "hnco/util.hh"         // hnco::is_in_range
+
+#include "crossover.hh"
+
+
+namespace hnco {
+namespace algorithm {
+
+
+/** Parallel reproduction.
+
+    Generates offsprings in parallel by selection, uniform crossover
+    and standard bit mutation. Each thread has its own copies of the
+    operators drawing from its own engine. Engines are seeded serially
+    from random::Generator::engine before each generation so that
+    results only depend on the seed and the number of threads.
+
+    \tparam Selection Selection type, which must provide set_engine,
+    init and select
+*/
+template<class Selection>
+class ParallelReproduction {
+
+  /// Engines, one per thread
+  std::vector<std::mt19937> _engines;
+
+  /// Selections, one per thread
+  std::vector<Selection> _selections;
+
+  /// Mutation operators, one per thread
+  std::vector<neighborhood::StandardBitMutation> _mutations;
+
+  /// Uniform crossovers, one per thread
+  std::vector<UniformCrossover> _crossovers;
+
+public:
+
+  /** Initialize.
+
+      Copies the operators, one copy per thread.
+
+      \param num_threads Number of threads
+      \param selection Selection
+      \param mutation Mutation operator
+      \param crossover Uniform crossover
+  */
+  void init(int num_threads, const Selection& selection,
+            const neighborhood::StandardBitMutation& mutation,
+            const UniformCrossover& crossover)
+  {
+    assert(num_threads > 0);
+
+    _engines.resize(num_threads);
+    _selections.clear();
+    _mutations.clear();
+    _crossovers.clear();
+    for (int k = 0; k < num_threads; k++) {
+      _selections.push_back(selection);
+      _selections[k].set_engine(&_engines[k]);
+      _mutations.push_back(mutation);
+      _mutations[k].set_engine(&_engines[k]);
+      _crossovers.push_back(crossover);
+      _crossovers[k].set_engine(&_engines[k]);
+    }
+  }
+
+  /** Generate offsprings.
+
+      \param offsprings Offsprings
+      \param crossover_probability Crossover probability
+  */
+  void generate(std::vector<bit_vector_t>& offsprings, double crossover_probability)
+  {
+    const int num_threads = _engines.size();
+    const int size = offsprings.size();
+
+    for (auto& engine : _engines)
+      engine.seed(random::Generator::engine());
+
+#pragma omp parallel num_threads(num_threads)
+    {
+      const int k = omp_get_thread_num();
+      assert(is_in_range(k, num_threads));
+
+      auto& engine = _engines[k];
+      auto& selection = _selections[k];
+      auto& mutation = _mutations[k];
+      auto& crossover = _crossovers[k];
+      std::bernoulli_distribution do_crossover(crossover_probability);
+      selection.init();
+
+#pragma omp for schedule(static)
+      for (int i = 0; i < size; i++) {
+        bit_vector_t& offspring = offsprings[i];
+        if (do_crossover(engine))
+          crossover.recombine(selection.select(), selection.select(), offspring);
+        else
+          offspring = selection.select();
+        mutation.mutate(offspring);
+      }
+    }
+  }
+
+};
+
+
+} // end of namespace algorithm
+} // end of namespace hnco
+
+
+#endif
@@ -112,6 +112,9 @@ public:
   ///@{
   /// Set the tournament size
   void set_tournament_size(int n) { _tournament_size = n; }
+
+  /// Set the random engine
+  void set_engine(std::mt19937 *engine) { _tournament_selection.set_engine(engine); }
   ///@}
 };
 
@@ -21,9 +21,12 @@
 #ifndef HNCO_ALGORITHMS_SELECTION_H
 #define HNCO_ALGORITHMS_SELECTION_H
 
+#include <algorithm>            // std::partial_sort
 #include <utility>              // std::swap
+#include <vector>
 
 #include "hnco/util.hh"         // hnco::ensure
+#include "hnco/algorithms/delta-population.hh"
 #include "hnco/algorithms/population.hh"
 
 
@@ -71,9 +74,61 @@ public:
 };
 
 
+/**
+ * Comma selection for delta-encoded offsprings. Only the selected
+ * offsprings are materialized into full bit vectors.
+ */
+class DeltaCommaSelection
+{
+  /// Parent population
+  Population& _parents;
+
+  /// Offspring population
+  DeltaPopulation& _offsprings;
+
+  /// Next parent bit vectors
+  std::vector<bit_vector_t> _bvs;
+
+public:
+
+  /**
+   * Constructor.
+   * @param parents Parent population
+   * @param offsprings Offspring population
+   */
+  DeltaCommaSelection(Population& parents, DeltaPopulation& offsprings)
+    : _parents(parents)
+    , _offsprings(offsprings)
+    , _bvs(parents.get_size(), bit_vector_t(parents.get_bv_size()))
+  {
+    ensure(offsprings.get_size() >= parents.get_size(),
+           "DeltaCommaSelection::DeltaCommaSelection: offspring population size must be greater than or equal to parent population size");
+    ensure(offsprings.get_bv_size() == parents.get_bv_size(),
+           "DeltaCommaSelection::DeltaCommaSelection: bit vectors in parent and offspring populations must have the same size");
+  }
+
+  /// Apply selection
+  void select() {
+    _offsprings.partial_sort(_parents.get_size());
+    for (int i = 0; i < _parents.get_size(); i++)
+      _offsprings.materialize(_offsprings.get_best_index(i), _parents, _bvs[i]);
+    for (int i = 0; i < _parents.get_size(); i++)
+      _parents.values[i] = _offsprings.get_best_value(i);
+    std::swap(_parents.bvs, _bvs);
+    perm_identity(_parents.permutation);
+  }
+
+};
+
+
 /**
  * Plus selection. Used as selection for replacement in evolutionary
  * algorithms.
+ *
+ * Offsprings are delta-encoded. Parents and offsprings are ranked
+ * through their values only. Selected offsprings are then
+ * materialized into full bit vectors whereas selected parents are
+ * moved.
  */
 class PlusSelection
 {
@@ -81,10 +136,16 @@ class PlusSelection
   Population& _parents;
 
   /// Offspring population
-  Population& _offsprings;
+  DeltaPopulation& _offsprings;
+
+  /// Values of parents followed by values of offsprings
+  std::vector<double> _values;
 
-  /// Union of parent and offspring population
-  Population _pool;
+  /// Permutation of parents and offsprings
+  permutation_t _permutation;
+
+  /// Next parent bit vectors
+  std::vector<bit_vector_t> _bvs;
 
 public:
 
@@ -93,31 +154,44 @@ public:
    * @param parents Parent population
    * @param offsprings Offspring population
    */
-  PlusSelection(Population& parents, Population& offsprings)
+  PlusSelection(Population& parents, DeltaPopulation& offsprings)
     : _parents(parents)
     , _offsprings(offsprings)
-    , _pool(parents.get_size() + offsprings.get_size(), parents.get_bv_size())
+    , _values(parents.get_size() + offsprings.get_size())
+    , _permutation(parents.get_size() + offsprings.get_size())
+    , _bvs(parents.get_size(), bit_vector_t(parents.get_bv_size()))
   {
     ensure(offsprings.get_bv_size() == parents.get_bv_size(),
            "PlusSelection::PlusSelection: bit vectors in parent and offspring populations must have the same size");
+    perm_identity(_permutation);
   }
 
   /// Apply selection
   void select() {
-    for (int i = 0; i < _parents.get_size(); i++) {
-      _pool.values[i] = _parents.values[i];
-      std::swap(_pool.bvs[i], _parents.bvs[i]);
+    const int mu = _parents.get_size();
+    for (int i = 0; i < mu; i++)
+      _values[i] = _parents.values[i];
+    for (int i = 0; i < _offsprings.get_size(); i++)
+      _values[mu + i] = _offsprings.values[i];
+
+    perm_shuffle(_permutation);
+    auto compare = [this](int i, int j){ return _values[i] > _values[j]; };
+    std::partial_sort(_permutation.begin(), _permutation.begin() + mu, _permutation.end(), compare);
+
+    // Offsprings refer to parents hence must be materialized first
+    for (int i = 0; i < mu; i++) {
+      const int j = _permutation[i];
+      if (j >= mu)
+        _offsprings.materialize(j - mu, _parents, _bvs[i]);
     }
-    int offset = _parents.get_size();
-    for (int i = 0; i < _offsprings.get_size(); i++) {
-      _pool.values[offset + i] = _offsprings.values[i];
-      std::swap(_pool.bvs[offset + i], _offsprings.bvs[i]);
-    }
-    _pool.partial_sort(_parents.get_size());
-    for (int i = 0; i < _parents.get_size(); i++) {
-      _parents.values[i] = _pool.get_best_value(i);
-      std::swap(_parents.bvs[i], _pool.get_best_bv(i));
+    for (int i = 0; i < mu; i++) {
+      const int j = _permutation[i];
+      if (j < mu)
+        std::swap(_bvs[i], _parents.bvs[j]);
     }
+    for (int i = 0; i < mu; i++)
+      _parents.values[i] = _values[_permutation[i]];
+    std::swap(_parents.bvs, _bvs);
     perm_identity(_parents.permutation);
   }
 
@@ -0,0 +1,78 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+#include "steady-state-ga.hh"
+
+
+using namespace hnco::algorithm;
+using namespace hnco::random;
+using namespace hnco;
+
+
+void
+SteadyStateGa::init()
+{
+  SteadyStateAlgorithm::init();
+
+  _do_crossover = std::bernoulli_distribution(_crossover_probability);
+
+  _mutation.set_mutation_rate(_mutation_rate);
+  _mutation.set_allow_no_mutation(_allow_no_mutation);
+
+  _population.random();
+  if (_functions.size() > 1)
+    _population.evaluate_in_parallel(_functions);
+  else
+    _population.evaluate(_function);
+  _population.sort();
+
+  set_solution(_population.get_best_bv(),
+               _population.get_best_value());
+
+  _worst = _population.find_worst_index();
+
+  _tournament_selection.set_tournament_size(_tournament_size);
+  _tournament_selection.init();
+}
+
+
+void
+SteadyStateGa::generate(bit_vector_t& candidate)
+{
+  // Crossover
+  if (_do_crossover(Generator::engine))
+    _crossover.recombine(_tournament_selection.select(), _tournament_selection.select(), candidate);
+  else
+    candidate = _tournament_selection.select();
+
+  // Mutation
+  _mutation.mutate(candidate);
+}
+
+
+void
+SteadyStateGa::integrate(const bit_vector_t& candidate, double value)
+{
+  if (value >= _population.values[_worst]) {
+    _population.bvs[_worst] = candidate;
+    _population.values[_worst] = value;
+    _worst = _population.find_worst_index();
+    update_solution(candidate, value);
+  }
+}
@@ -30,7 +30,9 @@ using namespace hnco::algorithm;
 void
 TwoRateOnePlusLambdaEa::init()
 {
-  random_solution();
+  _parent.random();
+  _parent.evaluate(_function);
+  set_solution(_parent.bvs[0], _parent.values[0]);
   _mutation_rate = _mutation_rate_init;
   _mutation_operator.set_allow_no_mutation(_allow_no_mutation);
   set_something_to_log();
@@ -46,20 +48,31 @@ TwoRateOnePlusLambdaEa::iterate()
 
   // Generate population
   _mutation_operator.set_mutation_rate(low);
-  for (int i = 0; i < mid; i++)
-    _mutation_operator.map(_solution.first, _population.bvs[i]);
+  for (int i = 0; i < mid; i++) {
+    _mutation_operator.sample_flipped_bits();
+    _population.flipped_bits[i] = _mutation_operator.get_flipped_bits();
+  }
 
   _mutation_operator.set_mutation_rate(high);
-  for (int i = mid; i < lambda; i++)
-    _mutation_operator.map(_solution.first, _population.bvs[i]);
+  for (int i = mid; i < lambda; i++) {
+    _mutation_operator.sample_flipped_bits();
+    _population.flipped_bits[i] = _mutation_operator.get_flipped_bits();
+  }
 
   // Evaluate and sort
   if (_functions.size() > 1)
-    _population.evaluate_in_parallel(_functions);
+    _population.evaluate_in_parallel(_parent, _functions);
   else
-    _population.evaluate(_function);
+    _population.evaluate(_parent, _function);
   _population.sort();
-  update_solution(_population.get_best_bv(), _population.get_best_value());
+
+  // Only the best offspring is materialized
+  const int best = _population.get_best_index(0);
+  if (_population.values[best] > _parent.values[0]) {
+    bv_flip(_parent.bvs[0], _population.flipped_bits[best]);
+    _parent.values[0] = _population.values[best];
+    set_solution(_parent.bvs[0], _parent.values[0]);
+  }
 
   // Update mutation rate
   double number = random::Generator::uniform();
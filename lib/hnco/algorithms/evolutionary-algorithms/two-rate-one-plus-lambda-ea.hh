@@ -21,6 +21,7 @@
 #ifndef HNCO_ALGORITHMS_EA_TWO_RATE_ONE_PLUS_LAMBDA_EA
 #define HNCO_ALGORITHMS_EA_TWO_RATE_ONE_PLUS_LAMBDA_EA
 
+#include "hnco/algorithms/delta-population.hh"
 #include "hnco/algorithms/iterative-algorithm.hh"
 #include "hnco/algorithms/population.hh"
 #include "hnco/neighborhoods/neighborhood.hh"
@@ -39,12 +40,16 @@ namespace algorithm {
  * Computation Conference (GECCO '17). Association for Computing
  * Machinery, New York, NY, USA, 1351–1358.
  * https://doi.org/10.1145/3071178.3071279
+ *
+ * Offsprings are delta-encoded with respect to the single parent,
+ * which is kept equal to the solution.
  */
 class TwoRateOnePlusLambdaEa: public IterativeAlgorithm {
 public:
   /// Constructor
   TwoRateOnePlusLambdaEa(int n, int population_size)
     : IterativeAlgorithm(n)
+    , _parent(1, n)
     , _population(population_size, n)
     , _mutation_operator(n)
     , _mutation_rate_init(2 / double(n))
@@ -70,8 +75,10 @@ public:
   ///@}
 
 protected:
+  /// Parent
+  Population _parent;
   /// Population
-  Population _population;
+  DeltaPopulation _population;
   /// Mutation operator
   neighborhood::StandardBitMutation _mutation_operator;
   /// Mutation rate
@@ -71,6 +71,6 @@ Hboa::maximize(const std::vector<function::Function *>& functions)
 void
 Hboa::finalize()
 {
-  bv_from_vector_bool(_solution.first, _implementation->middle_layer->best_solution);
-  _solution.second = _implementation->middle_layer->best_fitness;
+  if (_implementation->evaluator->has_best())
+    _solution = _implementation->evaluator->get_best();
 }
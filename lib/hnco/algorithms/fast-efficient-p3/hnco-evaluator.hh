@@ -24,6 +24,7 @@
 #include <cassert>
 
 #include "hnco/functions/function.hh"
+#include "hnco/algorithms/solution.hh"
 
 #include "fast-efficient-p3/Evaluation.h"
 
@@ -32,7 +33,11 @@ namespace hnco {
 namespace algorithm {
 namespace fast_efficient_p3 {
 
-/// Evaluator for HNCO functions
+/** Evaluator for HNCO functions.
+
+    Evaluators return float values. The best solution is kept with its
+    value in double precision.
+*/
 class HncoEvaluator: public Evaluator {
 
   /// HNCO function
@@ -41,6 +46,12 @@ class HncoEvaluator: public Evaluator {
   /// Argument of HNCO function
   hnco::bit_vector_t _bv;
 
+  /// Best solution
+  hnco::algorithm::solution_t _best;
+
+  /// Best solution flag
+  bool _has_best = false;
+
 public:
 
   /// Constructor
@@ -57,9 +68,21 @@ public:
     assert(x.size() == _bv.size());
 
     bv_from_vector_bool(_bv, x);
-    return _function->evaluate(_bv);
+    double value = _function->evaluate(_bv);
+    if (!_has_best || value > _best.second) {
+      _best.first = _bv;
+      _best.second = value;
+      _has_best = true;
+    }
+    return value;
   }
 
+  /// Check whether at least one bit vector has been evaluated
+  bool has_best() const { return _has_best; }
+
+  /// Get the best solution
+  const hnco::algorithm::solution_t& get_best() const { return _best; }
+
 };
 
 } // end of namespace fast_efficient_p3
@@ -78,6 +78,6 @@ Ltga::maximize(const std::vector<function::Function *>& functions)
 void
 Ltga::finalize()
 {
-  bv_from_vector_bool(_solution.first, _implementation->middle_layer->best_solution);
-  _solution.second = _implementation->middle_layer->best_fitness;
+  if (_implementation->evaluator->has_best())
+    _solution = _implementation->evaluator->get_best();
 }
@@ -22,6 +22,8 @@
 #define HNCO_ALGORITHMS_GOMEA_HNCO_FITNESS_H
 
 #include <cassert>
+#include <cstring>              // std::memcpy
+#include <algorithm>            // std::all_of
 
 #include "hnco/functions/function.hh"
 
@@ -53,11 +55,10 @@ public:
 
   /// Evaluate a bit vector
   double objectiveFunction(int objective_index, ::gomea::vec_t<char>& variables) override {
+    static_assert(sizeof(char) == sizeof(bit_t), "HncoFitness::objectiveFunction: char and bit_t must have the same size");
     assert(variables.size() == _bv.size());
-    for (size_t i = 0; i < _bv.size(); ++i) {
-      assert(variables[i] == 0 || variables[i] == 1);
-      _bv[i] = variables[i];
-    }
+    assert(std::all_of(variables.begin(), variables.end(), [](char b){ return b == 0 || b == 1; }));
+    std::memcpy(_bv.data(), variables.data(), _bv.size());
     return _function->evaluate(_bv);
   }
 
@@ -31,7 +31,7 @@ IterativeAlgorithm::loop()
   _last_iteration = false;
   if (_num_iterations > 0) {
     for (_iteration = 0; _iteration < _num_iterations; _iteration++) {
-      if (_last_iteration)
+      if (_last_iteration || stop_requested())
         break;
       iterate();
       if (_something_to_log)
@@ -39,7 +39,7 @@ IterativeAlgorithm::loop()
     }
   } else {
     for (_iteration = 0;; _iteration++) {
-      if (_last_iteration)
+      if (_last_iteration || stop_requested())
         break;
       iterate();
       if (_something_to_log)
@@ -68,6 +68,8 @@ protected:
 
       Calls init() then enter the main loop which, at each iteration,
       calls iterate() then log() only if _something_to_log is true.
+      The loop ends after the last iteration or as soon as a stop
+      has been requested.
   */
   virtual void loop() final;
 
@@ -22,6 +22,7 @@
 #include <math.h>               // std::log
 
 #include <algorithm>            // std::fill, std::min, std::swap, std::min_element, std::all_of
+#include <bitset>
 
 #include "hnco/algorithms/probability-vector/probability-vector.hh"
 #include "hnco/random.hh"
@@ -64,7 +65,49 @@ Mimic::sample(bit_vector_t& bv)
 }
 
 void
-Mimic::compute_conditional_entropy(int index)
+Mimic::compute_columns()
+{
+  const int n = get_bv_size();
+
+  _num_words = (_selection_size + 63) / 64;
+  _columns.assign(std::size_t(n) * _num_words, 0);
+
+  for (int k = 0; k < _selection_size; k++) {
+    const bit_vector_t& bv = _population.get_best_bv(k);
+    const std::uint64_t mask = std::uint64_t(1) << (k % 64);
+    std::uint64_t *words = _columns.data() + k / 64;
+    for (int i = 0; i < n; i++)
+      if (bv[i])
+        words[std::size_t(i) * _num_words] |= mask;
+  }
+
+  for (int i = 0; i < n; i++) {
+    const std::uint64_t *column = _columns.data() + std::size_t(i) * _num_words;
+    int count = 0;
+    for (int w = 0; w < _num_words; w++)
+      count += std::bitset<64>(column[w]).count();
+    _column_counts[i] = count;
+  }
+}
+
+void
+Mimic::compute_table(int first, int second, table_t& table) const
+{
+  const std::uint64_t *x = _columns.data() + std::size_t(first) * _num_words;
+  const std::uint64_t *y = _columns.data() + std::size_t(second) * _num_words;
+
+  int both = 0;
+  for (int w = 0; w < _num_words; w++)
+    both += std::bitset<64>(x[w] & y[w]).count();
+
+  table[1][1] = both;
+  table[1][0] = _column_counts[first] - both;
+  table[0][1] = _column_counts[second] - both;
+  table[0][0] = _selection_size - _column_counts[first] - _column_counts[second] + both;
+}
+
+void
+Mimic::compute_conditional_entropy(int index, const table_t& table)
 {
   assert(index >= 0);
   assert(index < int(_entropies.size()));
@@ -72,15 +115,15 @@ Mimic::compute_conditional_entropy(int index)
   double entropy = 0;
   int total = 0;
 
-  for (size_t i = 0; i < _table.size(); i++)  {
-    int count = _table[i][0] + _table[i][1];
+  for (size_t i = 0; i < table.size(); i++)  {
+    int count = table[i][0] + table[i][1];
     if (count) {
-      if (_table[i][0])
-        entropy += _table[i][0] * std::log(double(count) / _table[i][0]);
-      if (_table[i][1])
-        entropy += _table[i][1] * std::log(double(count) / _table[i][1]);
+      if (table[i][0])
+        entropy += table[i][0] * std::log(double(count) / table[i][0]);
+      if (table[i][1])
+        entropy += table[i][1] * std::log(double(count) / table[i][1]);
     }
-    _parameters[i][index] = count ? _table[i][1] / double(count) : 0.5;
+    _parameters[i][index] = count ? table[i][1] / double(count) : 0.5;
     total += count;
   }
 
@@ -111,24 +154,24 @@ Mimic::update_model()
   _parameters[0][0] = _mean[root];
   _parameters[1][0] = _mean[root];
 
-  for (size_t i = 1; i < _permutation.size(); i++) {
+  compute_columns();
+
+  const int n = _permutation.size();
+  for (int i = 1; i < n; i++) {
     int first = _permutation[i - 1];
 
-    for (size_t j = i; j < _permutation.size(); j++) {
+#pragma omp parallel for
+    for (int j = i; j < n; j++) {
       int second = _permutation[j];
       assert(second != first);
 
-      _table.fill({0, 0});
-      for (int k = 0; k < _selection_size; k++) {
-        const bit_vector_t& bv = _population.get_best_bv(k);
-        _table[bv[first]][bv[second]]++;
-      }
-
-      compute_conditional_entropy(j);
+      table_t table;
+      compute_table(first, second, table);
+      compute_conditional_entropy(j, table);
     }
 
-    size_t child = std::min_element(_entropies.begin() + i, _entropies.end()) - _entropies.begin();
-    assert(child < _permutation.size());
+    int child = std::min_element(_entropies.begin() + i, _entropies.end()) - _entropies.begin();
+    assert(child < n);
 
     if (child != i) {
       std::swap(_permutation[i], _permutation[child]);
@@ -22,6 +22,7 @@
 #define HNCO_ALGORITHMS_MIMIC_H
 
 #include <array>
+#include <cstdint>              // std::uint64_t
 #include <vector>
 
 #include "hnco/algorithms/iterative-algorithm.hh"
@@ -48,11 +49,18 @@ namespace algorithm {
     Advances in Neural Information Processing Systems, 1996, MIT
     Press.
 
+    Selected bit vectors are transposed into packed columns so that
+    each contingency table is computed with popcounts of bitwise
+    ands. Candidate children are evaluated in parallel.
+
 */
 class Mimic: public IterativeAlgorithm {
 
 protected:
 
+  /// Contingency table
+  using table_t = std::array<std::array<int, 2>, 2>;
+
   /// Population
   Population _population;
 
@@ -68,8 +76,14 @@ protected:
   /// Conditional entropies
   std::vector<double> _entropies;
 
-  /// Contingency table
-  std::array<std::array<int, 2>, 2> _table;
+  /// Columns of selected bit vectors, packed in words
+  std::vector<std::uint64_t> _columns;
+
+  /// Number of words per column
+  int _num_words;
+
+  /// Number of ones per column
+  std::vector<int> _column_counts;
 
   /// Lower bound of probability
   double _lower_bound;
@@ -104,8 +118,14 @@ protected:
   /// Sample a bit vector
   void sample(bit_vector_t& bv);
 
+  /// Transpose selected bit vectors into columns
+  void compute_columns();
+
+  /// Compute the contingency table of a pair of variables
+  void compute_table(int first, int second, table_t& table) const;
+
   /// Compute conditional entropy
-  void compute_conditional_entropy(int index);
+  void compute_conditional_entropy(int index, const table_t& table);
 
   /// Update model
   void update_model();
@@ -119,6 +139,7 @@ public:
     _permutation(n),
     _mean(n),
     _entropies(n),
+    _column_counts(n),
     _lower_bound(1 / double(n)),
     _upper_bound(1 - 1 / double(n)),
     _selection_size(population_size / 2)
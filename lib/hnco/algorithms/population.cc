@@ -20,8 +20,9 @@
 
 #include <omp.h>                // omp_get_thread_num
 
-#include <algorithm>            // std::equal_range
+#include <algorithm>            // std::equal_range, std::fill
 #include <iterator>             // std::distance
+#include <limits>               // std::numeric_limits
 
 #include "hnco/util.hh"         // hnco::is_in_range
 
@@ -45,8 +46,15 @@ Population::evaluate(Function *function)
   assert(have_same_size(bvs, values));
   assert(function);
 
-  for (size_t i = 0; i < bvs.size(); i++)
+  const StopToken *token = function->get_stop_token();
+
+  for (size_t i = 0; i < bvs.size(); i++) {
+    if (token && token->stop_requested()) {
+      std::fill(values.begin() + i, values.end(), -std::numeric_limits<double>::infinity());
+      break;
+    }
     values[i] = function->evaluate(bvs[i]);
+  }
 }
 
 void
@@ -55,17 +63,29 @@ Population::evaluate_in_parallel(const std::vector<Function *>& fns)
   assert(have_same_size(bvs, values));
   assert(!fns.empty());
 
-#pragma omp parallel for
-  for (size_t i = 0; i < bvs.size(); i++) {
+  const StopToken *token = fns[0]->get_stop_token();
+  const int size = bvs.size();
+  const int num_reserved = fns[0]->reserve_evaluations(size);
+  const int num_threads = fns.size();
+
+#pragma omp parallel for num_threads(num_threads)
+  for (int i = 0; i < num_reserved; i++) {
     int k = omp_get_thread_num();
     assert(is_in_range(k, fns.size()));
     assert(fns[k]);
 
+    if (token && token->stop_requested())
+      continue;
     values[i] = fns[k]->evaluate_safely(bvs[i]);
   }
 
-  for (size_t i = 0; i < bvs.size(); i++)
+  int i = 0;
+  for (; i < num_reserved; i++) {
+    if (token && token->stop_requested())
+      break;
     fns[0]->update(bvs[i], values[i]);
+  }
+  std::fill(values.begin() + i, values.end(), -std::numeric_limits<double>::infinity());
 }
 
 std::pair<int, int>
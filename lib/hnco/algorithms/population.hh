@@ -21,8 +21,9 @@
 #ifndef HNCO_ALGORITHMS_POPULATION_H
 #define HNCO_ALGORITHMS_POPULATION_H
 
-#include <algorithm>            // std::sort
+#include <algorithm>            // std::sort, std::min_element
 #include <cassert>
+#include <iterator>             // std::distance
 #include <utility>              // std::pair
 
 #include "hnco/bit-vector.hh"
@@ -77,9 +78,22 @@ struct Population {
    * @name Evaluation and sorting
    */
   ///@{
-  /// Evaluate the population
+  /**
+   * Evaluate the population.
+   * If a stop is requested on the stop token of the function, the
+   * remaining bit vectors are not evaluated and their values are set
+   * to -infinity.
+   */
   void evaluate(Function *function);
-  /// Evaluate the population in parallel
+  /**
+   * Evaluate the population in parallel.
+   * One thread is used per function.
+   * Evaluations are reserved on the first function before being
+   * dispatched. Bit vectors beyond the granted evaluations are not
+   * evaluated and their values are set to -infinity. Same behavior
+   * as evaluate if a stop is requested on the stop token of the
+   * first function.
+   */
   void evaluate_in_parallel(const std::vector<Function *>& functions);
   /**
    * Sort the population. Only the permutation is sorted using the
@@ -117,6 +131,15 @@ struct Population {
    * @pre The population must be sorted.
    */
   std::pair<int, int> get_equivalent_bvs(int index) const;
+  /**
+   * Find the index of a worst bit vector. Linear scan which does not
+   * require the population to be sorted. Ties are broken in favor of
+   * the smallest index.
+   * @pre The population must be evaluated.
+   */
+  int find_worst_index() const {
+    return std::distance(values.begin(), std::min_element(values.begin(), values.end()));
+  }
   ///@}
 
   /**
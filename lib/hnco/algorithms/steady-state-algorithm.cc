@@ -0,0 +1,152 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+#include <omp.h>                // omp_get_thread_num
+
+#include <chrono>               // std::chrono::steady_clock
+#include <exception>            // std::exception_ptr
+
+#include "hnco/util.hh"         // hnco::is_in_range
+
+#include "steady-state-algorithm.hh"
+
+
+using namespace hnco::algorithm;
+using namespace hnco::function;
+using namespace hnco;
+
+
+void
+SteadyStateAlgorithm::init()
+{
+  _num_evaluations = 0;
+  _elapsed_time = 0;
+  _num_threads = _functions.size();
+}
+
+
+void
+SteadyStateAlgorithm::iterate()
+{
+  std::exception_ptr exception;
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    if (_functions.size() > 1)
+      run_asynchronously();
+    else
+      run_serially();
+  }
+  catch (...) {
+    exception = std::current_exception();
+  }
+  _elapsed_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  _last_iteration = true;
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+
+void
+SteadyStateAlgorithm::run_serially()
+{
+  while ((_num_iterations <= 0 || _num_evaluations < _num_iterations) && !stop_requested()) {
+    generate(_candidate);
+    double value = _function->evaluate(_candidate);
+    integrate(_candidate, value);
+    _num_evaluations++;
+  }
+}
+
+
+void
+SteadyStateAlgorithm::run_asynchronously()
+{
+  const int num_threads = _functions.size();
+  long num_generated = 0;
+  bool stop = false;
+  std::exception_ptr exception;
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    const int k = omp_get_thread_num();
+    assert(is_in_range(k, num_threads));
+    assert(_functions[k]);
+
+    bit_vector_t candidate(get_bv_size());
+
+    for (;;) {
+      bool done;
+
+#pragma omp critical(hnco_steady_state)
+      {
+        done = stop || stop_requested() || (_num_iterations > 0 && num_generated >= _num_iterations);
+        if (!done) {
+          try {
+            done = _function->reserve_evaluations(1) == 0;
+          }
+          catch (...) {
+            exception = std::current_exception();
+            stop = true;
+            done = true;
+          }
+        }
+        if (!done) {
+          generate(candidate);
+          num_generated++;
+        }
+      }
+
+      if (done)
+        break;
+
+      double value = _functions[k]->evaluate_safely(candidate);
+
+#pragma omp critical(hnco_steady_state)
+      {
+        if (!stop && !stop_requested()) {
+          try {
+            _function->update(candidate, value);
+            integrate(candidate, value);
+            _num_evaluations++;
+          }
+          catch (...) {
+            exception = std::current_exception();
+            stop = true;
+          }
+        }
+      }
+    }
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+
+double
+SteadyStateAlgorithm::get_throughput() const
+{
+  if (_elapsed_time > 0)
+    return _num_evaluations / (_elapsed_time * _num_threads);
+  else
+    return 0;
+}
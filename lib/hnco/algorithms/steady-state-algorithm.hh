@@ -0,0 +1,158 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef HNCO_ALGORITHMS_STEADY_STATE_ALGORITHM_H
+#define HNCO_ALGORITHMS_STEADY_STATE_ALGORITHM_H
+
+#include "iterative-algorithm.hh"
+
+
+namespace hnco {
+namespace algorithm {
+
+
+/** Steady-state algorithm.
+
+    A steady-state algorithm generates one candidate at a time and
+    integrates it into its state as soon as it has been evaluated.
+    The whole run takes place in a single call to iterate() and the
+    number of iterations is the number of integrated candidates.
+
+    If several functions are given to maximize, evaluation is
+    asynchronous. Each thread repeatedly generates a candidate,
+    evaluates it with its own function and integrates the result,
+    without waiting for the other threads. Generation and integration,
+    which access the state of the algorithm, are serialized whereas
+    evaluations run concurrently. There is no generation boundary at
+    which threads would sit idle, which pays off when evaluations are
+    expensive and their durations vary. Results depend on the order in
+    which evaluations complete, hence they are not reproducible.
+
+    A candidate is only generated if an evaluation can be reserved on
+    the first function (see Function::reserve_evaluations), hence no
+    evaluation is wasted beyond the budget.
+
+    When a stop is requested or the first function throws an
+    exception from reserve_evaluations or update, for example
+    LastEvaluation, no other candidate is generated and the results
+    of pending evaluations are discarded. The exception, if any, is
+    rethrown once all threads have stopped.
+*/
+class SteadyStateAlgorithm: public IterativeAlgorithm {
+
+  /// Candidate used in serial runs
+  bit_vector_t _candidate;
+
+  /// Number of integrated candidates
+  long _num_evaluations = 0;
+
+  /// Elapsed time of the steady-state phase (in seconds)
+  double _elapsed_time = 0;
+
+  /// Number of threads
+  int _num_threads = 1;
+
+  /// Run serially
+  void run_serially();
+
+  /// Run asynchronously
+  void run_asynchronously();
+
+protected:
+
+  /** @name Loop
+   */
+  ///@{
+
+  /** Initialize.
+
+      Derived classes must call it from their own init().
+  */
+  void init() override;
+
+  /// Single iteration
+  void iterate() override;
+
+  ///@}
+
+  /** @name Steady state
+   */
+  ///@{
+
+  /** Generate a candidate.
+
+      Never called concurrently with itself or integrate.
+
+      \param candidate Candidate to generate
+  */
+  virtual void generate(bit_vector_t& candidate) = 0;
+
+  /** Integrate an evaluated candidate.
+
+      Never called concurrently with itself or generate.
+
+      \param candidate Evaluated candidate
+      \param value Value of the candidate
+  */
+  virtual void integrate(const bit_vector_t& candidate, double value) = 0;
+
+  ///@}
+
+public:
+
+  /** Constructor.
+
+      \param n Size of bit vectors
+  */
+  SteadyStateAlgorithm(int n):
+    IterativeAlgorithm(n),
+    _candidate(n) {}
+
+  /** @name Statistics
+   */
+  ///@{
+
+  /// Get the number of integrated candidates
+  long get_num_evaluations() const { return _num_evaluations; }
+
+  /** Get the throughput.
+
+      Number of integrated candidates per second and per thread
+      during the steady-state phase. Evaluations of the initial
+      population are not taken into account.
+  */
+  double get_throughput() const;
+
+  /// Print the number of integrated candidates and the throughput
+  void print_statistics(std::ostream& stream) const override {
+    stream
+      << ",\n  \"num_steady_state_evaluations\": " << _num_evaluations
+      << ",\n  \"throughput\": "                   << get_throughput();
+  }
+
+  ///@}
+
+};
+
+
+} // end of namespace algorithm
+} // end of namespace hnco
+
+
+#endif
@@ -171,22 +171,19 @@ protected:
 
     // Average best individuals
     _walsh_moment_best.init();
-    for (int i = 0; i < _selection_size; i++)
-      _walsh_moment_best.add(_population.get_best_bv(i));
+    _walsh_moment_best.add(_selection_size, [this](int i) -> const bit_vector_t& { return _population.get_best_bv(i); });
     _walsh_moment_best.average(_selection_size);
 
     if (_negative_positive_selection) {
       // Average worst individuals
       _walsh_moment_worst.init();
-      for (int i = 0; i < _selection_size; i++)
-        _walsh_moment_worst.add(_population.get_worst_bv(i));
+      _walsh_moment_worst.add(_selection_size, [this](int i) -> const bit_vector_t& { return _population.get_worst_bv(i); });
       _walsh_moment_worst.average(_selection_size);
       _model_parameters.update(_walsh_moment_best, _walsh_moment_worst, _learning_rate);
     } else {
       // Average all individuals
       _walsh_moment_all.init();
-      for (int i = 0; i < _population.get_size(); i++)
-        _walsh_moment_all.add(_population.bvs[i]);
+      _walsh_moment_all.add(_population.get_size(), [this](int i) -> const bit_vector_t& { return _population.bvs[i]; });
       _walsh_moment_all.average(_population.get_size());
       _model_parameters.update(_walsh_moment_best, _walsh_moment_all, _learning_rate);
     }
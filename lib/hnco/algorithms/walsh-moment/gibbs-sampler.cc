@@ -34,6 +34,8 @@ void
 TriangularMomentGibbsSampler::init()
 {
   bv_random(_state);
+  for (size_t i = 0; i < _state.size(); i++)
+    _spins[i] = 1 - 2 * int(_state[i]);
 }
 
 void
@@ -42,47 +44,28 @@ TriangularMomentGibbsSampler::update(int i)
   assert(is_in_range(i, 0, _state.size()));
 
   double delta = _model_parameters.first_moment[i];
-
-  const std::vector<double>& row = _model_parameters.second_moment[i];
-  for (int j = 0; j < i; j++)
-    if (_state[j])
-      delta -= row[j];
-    else
-      delta += row[j];
-
-  for (size_t j = i + 1; j < _state.size(); j++) {
-    if (_state[j])
-      delta -= _model_parameters.second_moment[j][i];
-    else
-      delta += _model_parameters.second_moment[j][i];
-  }
+  delta += _model_parameters.local_field(i, _spins);
   delta *= -2;
 
   if (Generator::uniform() < logistic(delta))
     _state[i] = 1;
   else
     _state[i] = 0;
+  _spins[i] = 1 - 2 * int(_state[i]);
 }
 
 void
 TriangularMomentGibbsSampler::update_sync()
 {
+  _model_parameters.local_fields(_pv, _spins);
   for (size_t i = 0; i < _pv.size(); i++) {
-    double delta = _model_parameters.first_moment[i];
-    const std::vector<double>& row = _model_parameters.second_moment[i];
-    for (size_t j = 0; j < _state.size(); j++) {
-      if (j == i)
-        continue;
-      if (_state[j])
-        delta -= row[j];
-      else
-        delta += row[j];
-    }
+    double delta = _model_parameters.first_moment[i] + _pv[i];
     delta *= -2;
-
     _pv[i] = logistic(delta);
   }
   pv_sample(_pv, _state);
+  for (size_t i = 0; i < _state.size(); i++)
+    _spins[i] = 1 - 2 * int(_state[i]);
 }
 
 void
@@ -41,6 +41,9 @@ class TriangularMomentGibbsSampler {
   /// State of the Gibbs sampler
   bit_vector_t _state;
 
+  /// Spins of the state
+  std::vector<double> _spins;
+
   /// Probability vector for synchronous Gibbs sampling
   pv_t _pv;
 
@@ -53,6 +56,7 @@ public:
   TriangularMomentGibbsSampler(int n, const TriangularMoment& mp):
     _model_parameters(mp),
     _state(n),
+    _spins(n),
     _pv(n) {}
 
   /// Initialize
@@ -123,8 +123,7 @@ class Hea: public algorithm::IterativeAlgorithm {
                     _population.get_best_value());
 
     _selection.init();
-    for (int i = 0; i < _selection_size; i++)
-      _selection.add(_population.get_best_bv(i));
+    _selection.add(_selection_size, [this](int i) -> const bit_vector_t& { return _population.get_best_bv(i); });
     if (_selection_size > 1)
       _selection.average(_selection_size);
 
@@ -18,6 +18,7 @@
 
 */
 
+#include <algorithm>            // std::fill
 #include <cassert>
 
 #include "hnco/util.hh"         // hnco::have_same_size
@@ -54,27 +55,15 @@ TriangularMomentHerding::sample(const TriangularMoment& target, bit_vector_t& bv
   _time++;
   _delta.scaled_difference(_time, target, _count);
 
+  // Spins of unset bits are equal to 0
+  std::fill(_spins.begin(), _spins.end(), 0);
   for (int k = 0; k < bv_size; k++) {
     int i = _randomize_bit_order ? _permutation[k] : k;
-    double acc = 0;
-    for (int l = 0; l < k; l++) {
-      int j = _randomize_bit_order ? _permutation[l] : l;
-      if (bv[j]) {
-        if (j < i)
-          acc -= _delta.second_moment[i][j];
-        else
-          acc -= _delta.second_moment[j][i];
-      } else {
-        if (j < i)
-          acc += _delta.second_moment[i][j];
-        else
-          acc += _delta.second_moment[j][i];
-      }
-    }
-    if (_delta.first_moment[i] + acc > 0)
+    if (_delta.first_moment[i] + _delta.local_field(i, _spins) > 0)
       bv[i] = 0;
     else
       bv[i] = 1;
+    _spins[i] = 1 - 2 * int(bv[i]);
   }
 
   _count.add(bv);
@@ -108,21 +97,20 @@ FullMomentHerding::sample(const FullMoment& target, bit_vector_t& bv)
   _time++;
   _delta.scaled_difference(_time, target, _count);
 
+  // Spins of unset bits are equal to 0
+  std::fill(_spins.begin(), _spins.end(), 0);
   for (int k = 0; k < bv_size; k++) {
     int i = _randomize_bit_order ? _permutation[k] : k;
-    const auto& row = _delta.second_moment[i];
-    double acc = 0;
-    for (int l = 0; l < k; l++) {
-      int j = _randomize_bit_order ? _permutation[l] : l;
-      if (bv[j])
-        acc -= row[j];
-      else
-        acc += row[j];
-    }
+    const double *row = _delta.second_moment[i].data();
+    const double *spins = _spins.data();
+    double acc =
+      spin_dot_product(row, spins, i) +
+      spin_dot_product(row + i + 1, spins + i + 1, bv_size - i - 1);
     if (_delta.first_moment[i] + acc > 0)
       bv[i] = 0;
     else
       bv[i] = 1;
+    _spins[i] = 1 - 2 * int(bv[i]);
   }
 
   _count.add(bv);
@@ -49,6 +49,8 @@ class TriangularMomentHerding {
   TriangularMoment _error;
   /// Permutation
   permutation_t _permutation;
+  /// Spins of the bits already sampled
+  std::vector<double> _spins;
   /// Time
   int _time;
   /**
@@ -70,7 +72,8 @@ public:
     _delta(n),
     _count(n),
     _error(n),
-    _permutation(n, 0) {}
+    _permutation(n, 0),
+    _spins(n) {}
   /// Initialization
   void init();
   /// Sample a bit vector
@@ -105,6 +108,8 @@ class FullMomentHerding {
   FullMoment _error;
   /// Permutation
   permutation_t _permutation;
+  /// Spins of the bits already sampled
+  std::vector<double> _spins;
   /// Time
   int _time;
   /**
@@ -126,7 +131,8 @@ public:
     _delta(n),
     _count(n),
     _error(n),
-    _permutation(n, 0) {}
+    _permutation(n, 0),
+    _spins(n) {}
   /// Initialization
   void init();
   /// Sample a bit vector
@@ -19,11 +19,11 @@
 */
 
 #include <iostream>
-#include <algorithm>            // std::clamp
+#include <algorithm>            // std::clamp, std::all_of
 #include <cassert>
 #include <cmath>		// std::sqrt
 
-#include "hnco/util.hh"         // hnco::have_same_size, hnco::is_in_interval, hnco::square
+#include "hnco/util.hh"         // hnco::have_same_size, hnco::is_in_interval, hnco::is_in_range, hnco::square
 
 #include "matrix.hh"           // hnco::algorithm::matrix_is_symmetric
 #include "walsh-moment.hh"
@@ -32,14 +32,59 @@ using namespace hnco::algorithm::walsh_moment;
 using namespace hnco::algorithm;
 using namespace hnco;
 
+double
+hnco::algorithm::walsh_moment::spin_dot_product(const double *x, const double *spins, int n)
+{
+  double result = 0;
+#pragma omp simd reduction(+:result)
+  for (int j = 0; j < n; j++)
+    result += x[j] * spins[j];
+  return result;
+}
+
 TriangularMoment::TriangularMoment(int n)
 {
   assert(n > 0);
 
   first_moment.resize(n);
-  second_moment.resize(n);
-  for (size_t i = 0; i < second_moment.size(); i++)
-    second_moment[i].resize(i);
+  second_moment.resize(row_offset(n));
+}
+
+double
+TriangularMoment::local_field(int i, const std::vector<double>& spins) const
+{
+  assert(hnco::have_same_size(spins, first_moment));
+  assert(is_in_range(i, first_moment.size()));
+
+  double result = spin_dot_product(get_row(i), spins.data(), i);
+
+  const int n = first_moment.size();
+  for (int j = i + 1; j < n; j++)
+    result += second_moment[row_offset(j) + i] * spins[j];
+
+  return result;
+}
+
+void
+TriangularMoment::local_fields(std::vector<double>& fields, const std::vector<double>& spins) const
+{
+  assert(hnco::have_same_size(spins, first_moment));
+  assert(hnco::have_same_size(fields, first_moment));
+
+  std::fill(fields.begin(), fields.end(), 0);
+  const int n = first_moment.size();
+  for (int i = 0; i < n; i++) {
+    const double *row = get_row(i);
+    const double si = spins[i];
+    double *f = fields.data();
+    double acc = 0;
+#pragma omp simd reduction(+:acc)
+    for (int j = 0; j < i; j++) {
+      acc += row[j] * spins[j];
+      f[j] += row[j] * si;
+    }
+    fields[i] += acc;
+  }
 }
 
 void
@@ -47,10 +92,10 @@ TriangularMoment::display(std::ostream& stream)
 {
   for (size_t i = 0; i < first_moment.size(); i++) {
     for (size_t j = 0; j < i; j++)
-      stream << second_moment[i][j] << " ";
+      stream << get_second_moment(i, j) << " ";
     stream << first_moment [i] << " ";
     for (size_t j = i + 1; j < first_moment.size(); j++)
-      stream << second_moment[j][i] << " ";
+      stream << get_second_moment(j, i) << " ";
     stream << std::endl;
   }
 }
@@ -59,8 +104,7 @@ void
 TriangularMoment::init()
 {
   std::fill(first_moment.begin(), first_moment.end(), 0);
-  for (auto& row : second_moment)
-    std::fill(row.begin(), row.end(), 0);
+  std::fill(second_moment.begin(), second_moment.end(), 0);
 }
 
 void
@@ -68,22 +112,33 @@ TriangularMoment::add(const bit_vector_t& bv)
 {
   assert(hnco::have_same_size(bv, first_moment));
 
-  for (size_t i = 0; i < bv.size(); i++) {
-    std::vector<double>& row = second_moment[i];
-    if (bv[i]) {
-      first_moment[i]--;
-      for (size_t j = 0; j < i; j++)
-        if (bv[j])
-          row[j]++;
-        else
-          row[j]--;
-    } else {
-      first_moment[i]++;
-      for (size_t j = 0; j < i; j++)
-        if (bv[j])
-          row[j]--;
-        else
-          row[j]++;
+  const int n = bv.size();
+  const bit_t *x = bv.data();
+  for (int i = 0; i < n; i++) {
+    double *row = get_row(i);
+    const double si = 1 - 2 * int(x[i]);
+    first_moment[i] += si;
+#pragma omp simd
+    for (int j = 0; j < i; j++)
+      row[j] += si * (1 - 2 * int(x[j]));
+  }
+}
+
+void
+TriangularMoment::add_spins(int count)
+{
+  assert(_spins.size() == std::size_t(count) * first_moment.size());
+
+  const int n = first_moment.size();
+  for (int i = 0; i < n; i++) {
+    double *row = get_row(i);
+    for (int k = 0; k < count; k++) {
+      const double *spins = _spins.data() + std::size_t(k) * n;
+      const double si = spins[i];
+      first_moment[i] += si;
+#pragma omp simd
+      for (int j = 0; j < i; j++)
+        row[j] += si * spins[j];
     }
   }
 }
@@ -91,16 +146,18 @@ TriangularMoment::add(const bit_vector_t& bv)
 void
 TriangularMoment::average(int count)
 {
-  for (size_t i = 0; i < first_moment.size(); i++) {
-    first_moment[i] /= count;
-    assert(is_in_interval(first_moment[i], -1, 1));
-
-    std::vector<double>& row = second_moment[i];
-    for (size_t j = 0; j < i; j++) {
-      row[j] /= count;
-      assert(is_in_interval(row[j], -1, 1));
-    }
+  for (auto& x : first_moment) {
+    x /= count;
+    assert(is_in_interval(x, -1, 1));
   }
+
+  const std::size_t size = second_moment.size();
+  double *m = second_moment.data();
+#pragma omp simd
+  for (std::size_t k = 0; k < size; k++)
+    m[k] /= count;
+
+  assert(std::all_of(second_moment.begin(), second_moment.end(), [](double x) { return is_in_interval(x, -1, 1); }));
 }
 
 void
@@ -111,14 +168,16 @@ TriangularMoment::update(const TriangularMoment& tm, double rate)
   for (size_t i = 0; i < first_moment.size(); i++) {
     first_moment[i] += rate * (tm.first_moment[i] - first_moment[i]);
     assert(is_in_interval(first_moment[i], -1, 1));
-
-    std::vector<double>& row = second_moment[i];
-    const std::vector<double>& row2 = tm.second_moment[i];
-    for (size_t j = 0; j < i; j++) {
-      row[j] += rate * (row2[j] - row[j]);
-      assert(is_in_interval(row[j], -1, 1));
-    }
   }
+
+  const std::size_t size = second_moment.size();
+  double *m = second_moment.data();
+  const double *m2 = tm.second_moment.data();
+#pragma omp simd
+  for (std::size_t k = 0; k < size; k++)
+    m[k] += rate * (m2[k] - m[k]);
+
+  assert(std::all_of(second_moment.begin(), second_moment.end(), [](double x) { return is_in_interval(x, -1, 1); }));
 }
 
 void
@@ -127,16 +186,16 @@ TriangularMoment::update(const TriangularMoment& tm1, const TriangularMoment& tm
   assert(hnco::have_same_size(tm1.first_moment, first_moment));
   assert(hnco::have_same_size(tm2.first_moment, first_moment));
 
-  for (size_t i = 0; i < first_moment.size(); i++) {
+  for (size_t i = 0; i < first_moment.size(); i++)
     first_moment[i] += rate * (tm1.first_moment[i] - tm2.first_moment[i]);
 
-    std::vector<double>& row = second_moment[i];
-    const std::vector<double>& row1 = tm1.second_moment[i];
-    const std::vector<double>& row2 = tm2.second_moment[i];
-    for (size_t j = 0; j < i; j++) {
-      row[j] += rate * (row1[j] - row2[j]);
-    }
-  }
+  const std::size_t size = second_moment.size();
+  double *m = second_moment.data();
+  const double *m1 = tm1.second_moment.data();
+  const double *m2 = tm2.second_moment.data();
+#pragma omp simd
+  for (std::size_t k = 0; k < size; k++)
+    m[k] += rate * (m1[k] - m2[k]);
 }
 
 void
@@ -145,15 +204,16 @@ TriangularMoment::scaled_difference(double lambda, const TriangularMoment& tm1,
   assert(hnco::have_same_size(tm1.first_moment, first_moment));
   assert(hnco::have_same_size(tm2.first_moment, first_moment));
 
-  for (size_t i = 0; i < first_moment.size(); i++) {
+  for (size_t i = 0; i < first_moment.size(); i++)
     first_moment[i] = lambda * tm1.first_moment[i] - tm2.first_moment[i];
-    std::vector<double>& row = second_moment[i];
-    const std::vector<double>& row1 = tm1.second_moment[i];
-    const std::vector<double>& row2 = tm2.second_moment[i];
-    for (size_t j = 0; j < i; j++) {
-      row[j] = lambda * row1[j] - row2[j];
-    }
-  }
+
+  const std::size_t size = second_moment.size();
+  double *m = second_moment.data();
+  const double *m1 = tm1.second_moment.data();
+  const double *m2 = tm2.second_moment.data();
+#pragma omp simd
+  for (std::size_t k = 0; k < size; k++)
+    m[k] = lambda * m1[k] - m2[k];
 }
 
 void
@@ -165,15 +225,14 @@ TriangularMoment::bound(double margin)
   const double low = margin - 1;
   assert(low < high);
 
-  for (size_t i = 0; i < first_moment.size(); i++) {
-    first_moment[i] = std::clamp(first_moment[i], low, high);
-    assert(is_in_interval(first_moment[i], -1, 1));
+  for (auto& x : first_moment) {
+    x = std::clamp(x, low, high);
+    assert(is_in_interval(x, -1, 1));
+  }
 
-    std::vector<double>& row = second_moment[i];
-    for (size_t j = 0; j < i; j++) {
-      row[j] = std::clamp(row[j], low, high);
-      assert(is_in_interval(row[j], -1, 1));
-    }
+  for (auto& x : second_moment) {
+    x = std::clamp(x, low, high);
+    assert(is_in_interval(x, -1, 1));
   }
 }
 
@@ -181,12 +240,10 @@ double
 TriangularMoment::norm_1() const
 {
   double result = 0;
-  for (size_t i = 0; i < first_moment.size(); i++) {
-    result += std::fabs(first_moment[i]);
-    const std::vector<double>& row = second_moment[i];
-    for (size_t j = 0; j < i; j++)
-      result += std::fabs(row[j]);
-  }
+  for (auto x : first_moment)
+    result += std::fabs(x);
+  for (auto x : second_moment)
+    result += std::fabs(x);
   return result;
 }
 
@@ -194,12 +251,10 @@ double
 TriangularMoment::norm_2() const
 {
   double result = 0;
-  for (size_t i = 0; i < first_moment.size(); i++) {
-    result += square(first_moment[i]);
-    const std::vector<double>& row = second_moment[i];
-    for (size_t j = 0; j < i; j++)
-      result += square(row[j]);
-  }
+  for (auto x : first_moment)
+    result += square(x);
+  for (auto x : second_moment)
+    result += square(x);
   return std::sqrt(result);
 }
 
@@ -207,12 +262,10 @@ double
 TriangularMoment::norm_infinite() const
 {
   double result = 0;
-  for (size_t i = 0; i < first_moment.size(); i++) {
-    result = std::max(result, first_moment[i]);
-    const std::vector<double>& row = second_moment[i];
-    for (size_t j = 0; j < i; j++)
-      result = std::max(result, row[j]);
-  }
+  for (auto x : first_moment)
+    result = std::max(result, x);
+  for (auto x : second_moment)
+    result = std::max(result, x);
   return result;
 }
 
@@ -222,13 +275,10 @@ TriangularMoment::distance(const TriangularMoment& tm) const
   assert(hnco::have_same_size(tm.first_moment, first_moment));
 
   double result = 0;
-  for (size_t i = 0; i < first_moment.size(); i++) {
+  for (size_t i = 0; i < first_moment.size(); i++)
     result += square(first_moment[i] - tm.first_moment[i]);
-    const std::vector<double>& row = second_moment[i];
-    const std::vector<double>& row2 = tm.second_moment[i];
-    for (size_t j = 0; j < i; j++)
-      result += square(row[j] - row2[j]);
-  }
+  for (size_t k = 0; k < second_moment.size(); k++)
+    result += square(second_moment[k] - tm.second_moment[k]);
   return std::sqrt(result);
 }
 
@@ -271,23 +321,15 @@ FullMoment::add(const bit_vector_t& bv)
 {
   assert(have_same_size(bv, first_moment));
 
-  for (size_t i = 0; i < bv.size(); i++) {
-    std::vector<double>& row = second_moment[i];
-    if (bv[i]) {
-      first_moment[i]--;
-      for (size_t j = 0; j < i; j++)
-        if (bv[j])
-          row[j]++;
-        else
-          row[j]--;
-    } else {
-      first_moment[i]++;
-      for (size_t j = 0; j < i; j++)
-        if (bv[j])
-          row[j]--;
-        else
-          row[j]++;
-    }
+  const int n = bv.size();
+  const bit_t *x = bv.data();
+  for (int i = 0; i < n; i++) {
+    double *row = second_moment[i].data();
+    const double si = 1 - 2 * int(x[i]);
+    first_moment[i] += si;
+#pragma omp simd
+    for (int j = 0; j < i; j++)
+      row[j] += si * (1 - 2 * int(x[j]));
   }
 }
 
@@ -21,7 +21,9 @@
 #ifndef HNCO_ALGORITHMS_WALSH_MOMENT_WALSH_MOMENT_H
 #define HNCO_ALGORITHMS_WALSH_MOMENT_WALSH_MOMENT_H
 
+#include <cassert>
 #include <iosfwd>
+#include <vector>
 
 #include "hnco/bit-vector.hh"
 
@@ -29,19 +31,59 @@ namespace hnco {
 namespace algorithm {
 namespace walsh_moment {
 
+/**
+ * Dot product with spins.
+ * @param x Array of values
+ * @param spins Array of spins
+ * @param n Size of the arrays
+ */
+double spin_dot_product(const double *x, const double *spins, int n);
+
 /**
  * Triangular moment.
+ *
+ * The second moment is a strictly lower triangular matrix packed row
+ * by row in a contiguous array. Bits are mapped to spins, 0 to 1 and 1
+ * to -1, which turns additions into branch-free products.
  */
 struct TriangularMoment {
   /// First moment
   std::vector<double> first_moment;
-  /// Second moment
-  std::vector<std::vector<double>> second_moment;
+  /// Second moment, packed row by row
+  std::vector<double> second_moment;
+  /// Offset of a row in the packed second moment
+  static std::size_t row_offset(int i) { return std::size_t(i) * (std::size_t(i) - 1) / 2; }
   /**
    * Constructor.
    * @param n Size of bit vector
    */
   TriangularMoment(int n);
+  /// Get a row of the second moment
+  double *get_row(int i) { return second_moment.data() + row_offset(i); }
+  /// Get a row of the second moment
+  const double *get_row(int i) const { return second_moment.data() + row_offset(i); }
+  /**
+   * Get an entry of the second moment.
+   * @pre j < i
+   */
+  double get_second_moment(int i, int j) const { return second_moment[row_offset(i) + j]; }
+  /**
+   * Compute the local field of a bit.
+   * @param i Bit index
+   * @param spins Spins of the other bits
+   *
+   * Returns the sum over j != i of M(i, j) * spins[j], where M is the
+   * symmetric matrix defined by the second moment.
+   */
+  double local_field(int i, const std::vector<double>& spins) const;
+  /**
+   * Compute the local fields of all bits.
+   * @param fields Output local fields
+   * @param spins Spins of bits
+   *
+   * The second moment is traversed only once.
+   */
+  void local_fields(std::vector<double>& fields, const std::vector<double>& spins) const;
   /**
    * Display moment.
    *
@@ -54,6 +96,28 @@ struct TriangularMoment {
   void init();
   /// Add a bit vector
   void add(const bit_vector_t& bv);
+  /**
+   * Add bit vectors.
+   * @param count Number of bit vectors
+   * @param get_bv Function returning the i-th bit vector
+   *
+   * Rank-k update equivalent to count calls to add. Each row of the
+   * second moment is updated with all bit vectors while it is in
+   * cache.
+   */
+  template<class GetBv>
+  void add(int count, GetBv get_bv) {
+    const int n = first_moment.size();
+    _spins.resize(std::size_t(count) * n);
+    for (int k = 0; k < count; k++) {
+      const bit_vector_t& bv = get_bv(k);
+      assert(int(bv.size()) == n);
+      double *spins = _spins.data() + std::size_t(k) * n;
+      for (int i = 0; i < n; i++)
+        spins[i] = 1 - 2 * int(bv[i]);
+    }
+    add_spins(count);
+  }
   /**
    * Compute average.
    * @param count Number of previsously added bit vectors
@@ -120,6 +184,11 @@ struct TriangularMoment {
   double norm_infinite() const;
   /// distance between the moment and another moment
   double distance(const TriangularMoment& wm) const;
+private:
+  /// Spins of bit vectors for rank-k updates
+  std::vector<double> _spins;
+  /// Add the bit vectors the spins of which are in _spins
+  void add_spins(int count);
 };
 
 /**
@@ -147,6 +216,16 @@ struct FullMoment {
   void init();
   /// Add a bit vector
   void add(const bit_vector_t& bv);
+  /**
+   * Add bit vectors.
+   * @param count Number of bit vectors
+   * @param get_bv Function returning the i-th bit vector
+   */
+  template<class GetBv>
+  void add(int count, GetBv get_bv) {
+    for (int k = 0; k < count; k++)
+      add(get_bv(k));
+  }
   /**
    * Compute average.
    * @param count Number of previsously added bit vectors
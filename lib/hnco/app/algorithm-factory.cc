@@ -235,6 +235,21 @@ CommandLineAlgorithmFactory::make(int bv_size)
     return algo;
   }
 
+  case 315: {
+    auto algo = new MuPlusOneEa
+      (bv_size,
+       _options.get_ea_mu());
+
+    algo->set_num_iterations    (_options.get_num_iterations());
+
+    algo->set_allow_no_mutation (_options.with_ea_allow_no_mutation());
+
+    if (_options.with_ea_mutation_rate())
+      algo->set_mutation_rate(_options.get_ea_mutation_rate());
+
+    return algo;
+  }
+
   case 320: {
     auto algo = new MuCommaLambdaEa
       (bv_size,
@@ -307,6 +322,23 @@ CommandLineAlgorithmFactory::make(int bv_size)
     return algo;
   }
 
+  case 410: {
+    auto algo = new SteadyStateGa
+      (bv_size,
+       _options.get_ea_mu());
+
+    algo->set_crossover_probability (_options.get_ea_crossover_probability());
+    algo->set_num_iterations        (_options.get_num_iterations());
+    algo->set_tournament_size       (_options.get_ea_tournament_size());
+
+    algo->set_allow_no_mutation     (_options.with_ea_allow_no_mutation());
+
+    if (_options.with_ea_mutation_rate())
+      algo->set_mutation_rate(_options.get_ea_mutation_rate());
+
+    return algo;
+  }
+
   case 450: {
     auto algo = new OnePlusLambdaCommaLambdaGa
       (bv_size,
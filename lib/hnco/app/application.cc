@@ -25,9 +25,13 @@
 #include <algorithm>            // std::sort
 #include <iostream>
 #include <fstream>              // std::ifstream, std::ofstream
+#include <memory>               // std::unique_ptr, std::make_unique
+#include <utility>              // std::pair
 
 #include "hnco/algorithms/decorators/restart.hh"
 #include "hnco/exception.hh"
+#include "hnco/logging/log-sink.hh"
+#include "hnco/mapped-file.hh"
 #include "hnco/random.hh"
 #include "hnco/stop-watch.hh"   // StopWatch
 
@@ -99,6 +103,66 @@ CommandLineApplication::load_solution()
   }
 }
 
+void
+CommandLineApplication::print_walsh_transform()
+{
+  const int n = _fn->get_bv_size();
+  const std::size_t size = std::size_t(1) << n;
+
+  std::vector<double> in_memory_coefficients;
+  std::unique_ptr<MappedFile> file;
+  double *coefficients;
+
+  // Keeping all the terms would defeat out of core computation
+  if (_options.with_fn_walsh_transform_path() && _options.get_fn_walsh_transform_num_terms() <= 0)
+    throw std::runtime_error("CommandLineApplication::print_walsh_transform: fn_walsh_transform_num_terms must be positive with fn_walsh_transform_path");
+
+  if (_options.with_fn_walsh_transform_path()) {
+    file = std::make_unique<MappedFile>(_options.get_fn_walsh_transform_path(), size * sizeof(double));
+    coefficients = reinterpret_cast<double *>(file->writable_data());
+  } else {
+    if (n > 30)
+      std::cerr << "Warning: Walsh transform computation might take a long time or fail due to large bv_size" << std::endl;
+    in_memory_coefficients.resize(size);
+    coefficients = in_memory_coefficients.data();
+  }
+
+  evaluate_on_hypercube(_fns, coefficients);
+  fast_walsh_transform(coefficients, size);
+
+  // The largest amplitude of non constant terms
+  double norm = 0;
+  for (std::size_t i = 1; i < size; i++)
+    norm = std::max(norm, std::abs(coefficients[i]));
+
+  // Terms with the largest amplitudes
+  using Amplitude = std::pair<double, std::size_t>;
+  auto compare = [](const Amplitude& a, const Amplitude& b){ return a.first > b.first; };
+  const std::size_t num_terms = _options.get_fn_walsh_transform_num_terms();
+  std::vector<Amplitude> amplitudes;
+  for (std::size_t i = 1; i < size; i++) {
+    double amplitude = std::abs(coefficients[i]) / norm;
+    if (!(amplitude > 1e-10))
+      continue;
+    if (num_terms == 0 || amplitudes.size() < num_terms) {
+      amplitudes.push_back(std::make_pair(amplitude, i));
+      if (amplitudes.size() == num_terms)
+        std::make_heap(amplitudes.begin(), amplitudes.end(), compare);
+    } else if (amplitude > amplitudes.front().first) {
+      std::pop_heap(amplitudes.begin(), amplitudes.end(), compare);
+      amplitudes.back() = std::make_pair(amplitude, i);
+      std::push_heap(amplitudes.begin(), amplitudes.end(), compare);
+    }
+  }
+  std::sort(amplitudes.begin(), amplitudes.end(), compare);
+
+  bit_vector_t feature(n);
+  for (auto a : amplitudes) {
+    bv_from_size_type(feature, a.second);
+    std::cout << bv_hamming_weight(feature) << " " << a.first << std::endl;
+  }
+}
+
 void
 CommandLineApplication::print_information()
 {
@@ -133,28 +197,7 @@ CommandLineApplication::print_information()
   }
 
   if (_options.with_fn_walsh_transform()) {
-    if (_fn->get_bv_size() > 15)
-      std::cerr << "Warning: Walsh transform computation might take a long time or fail due to large bv_size" << std::endl;
-    std::vector<function::WalshTerm> terms;
-    compute_fast_walsh_transform(_fn, terms);
-    for (auto& t : terms)
-      t.coefficient = std::abs(t.coefficient);
-    std::sort(terms.begin(),
-              terms.end(),
-              [](const function::WalshTerm& a,
-                 const function::WalshTerm& b){ return a.coefficient > b.coefficient; });
-    assert(terms.size() > 0);
-    double norm;
-    if (bv_hamming_weight(terms[0].feature) == 0)
-      norm = terms[1].coefficient;
-    else
-      norm = terms[0].coefficient;
-    for (auto t : terms) {
-      int weight = bv_hamming_weight(t.feature);
-      double amplitude = t.coefficient / norm;
-      if (amplitude > 1e-10 && weight > 0)
-        std::cout << weight << " " << amplitude << std::endl;
-    }
+    print_walsh_transform();
     exit(0);
   }
 
@@ -215,6 +258,8 @@ CommandLineApplication::print_results(double total_time, bool target_reached)
   if (cache)
     results << ",\n  \"lookup_ratio\": " << cache->get_lookup_ratio();
 
+  _algorithm->print_statistics(results);
+
   results << "\n}\n";
 
   // Print results
@@ -266,6 +311,20 @@ CommandLineApplication::manage_solution(const bit_vector_t& bv)
   }
 }
 
+void
+CommandLineApplication::save_trace()
+{
+  auto tracker = _decorated_function_factory.get_tracker();
+  std::ofstream stream(_options.get_trace_path(), _options.with_trace_binary() ? std::ios::binary : std::ios::out);
+  if (!stream.good()) {
+    throw std::runtime_error("CommandLineApplication::save_trace: Cannot open " + _options.get_trace_path());
+  }
+  if (_options.with_trace_binary())
+    tracker->write_trace_binary(stream);
+  else
+    tracker->write_trace_csv(stream);
+}
+
 void
 CommandLineApplication::maximize()
 {
@@ -296,13 +355,27 @@ CommandLineApplication::maximize()
     solution = _algorithm->get_solution();
   }
 
+  // Controllers request a stop instead of throwing if the algorithm
+  // checks the stop token
+  auto stop_on_target = _decorated_function_factory.get_stop_on_target();
+  if (!target_reached && stop_on_target && stop_on_target->is_target_reached()) {
+    solution = stop_on_target->get_trigger();
+    target_reached = true;
+  }
+
   stop_watch.stop();
 
+  // Log lines must precede results
+  logging::LogSink::get().flush();
+
   if (_options.with_record_total_time())
     print_results(stop_watch.get_total_time(), target_reached);
   else
     print_results(0, target_reached);
 
+  if (_options.with_save_trace())
+    save_trace();
+
   manage_solution(solution.first);
 
   if (_options.with_stop_on_maximum() && !target_reached)
@@ -66,6 +66,14 @@ class CommandLineApplication {
   /// Print information about the function
   void print_information();
 
+  /** Print the amplitudes of the Walsh transform.
+
+      The Walsh transform is stored in memory or in a memory-mapped
+      file. Amplitudes are relative to the largest amplitude of non
+      constant terms.
+  */
+  void print_walsh_transform();
+
   /// Make algorithm
   void make_algorithm();
 
@@ -78,6 +86,9 @@ class CommandLineApplication {
   /// Manage solution
   void manage_solution(const bit_vector_t& bv);
 
+  /// Save the improvement trace
+  void save_trace();
+
 public:
 
   /** Constructor.
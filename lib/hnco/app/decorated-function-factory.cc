@@ -19,8 +19,12 @@
 */
 
 #include <fstream>              // std::ifstream
+#include <utility>              // std::pair
+
+#include <boost/serialization/utility.hpp>
 
 #include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/serialization.hh"
 
 #include "decorated-function-factory.hh"
 
@@ -37,8 +41,12 @@ using namespace hnco;
 
 
 template<class T>
-void load_map(T *map, const HncoOptions& options)
+void load_map(T *map, const HncoOptions& options, std::string name)
 {
+  if (is_binary_archive(options.get_map_path())) {
+    load_from_binary_archive(*map, options.get_map_path(), name);
+    return;
+  }
   std::ifstream ifs(options.get_map_path());
   if (!ifs.good()) {
     throw std::runtime_error("load_map: Cannot open " + options.get_map_path());
@@ -68,7 +76,7 @@ make_map(const HncoOptions& options, int bv_size)
         std::cerr << "Warning: make_map: Translation: using bv_size, discarding map_input_size" << std::endl;
       map->random(bv_size);
     } else
-      load_map<Translation>(map, options);
+      load_map<Translation>(map, options, "Translation");
     return map;
   }
 
@@ -79,7 +87,7 @@ make_map(const HncoOptions& options, int bv_size)
         std::cerr << "Warning: make_map: Permutation: using bv_size, discarding map_input_size" << std::endl;
       map->random(bv_size);
     } else
-      load_map<Permutation>(map, options);
+      load_map<Permutation>(map, options, "Permutation");
     return map;
   }
 
@@ -91,6 +99,11 @@ make_map(const HncoOptions& options, int bv_size)
         std::cerr << "Warning: make_map: Composition of permutation and translation: using bv_size, discarding map_input_size" << std::endl;
       permutation->random(bv_size);
       translation->random(bv_size);
+    } else if (is_binary_archive(options.get_map_path())) {
+      std::pair<Permutation, Translation> maps;
+      load_from_binary_archive(maps, options.get_map_path(), "PermutationTranslation");
+      *permutation = maps.first;
+      *translation = maps.second;
     } else {
       std::ifstream ifs(options.get_map_path());
       if (!ifs.good()) {
@@ -114,7 +127,7 @@ make_map(const HncoOptions& options, int bv_size)
         throw std::runtime_error("make_map: map_input_size must be positive");
       map->random(bv_size, options.get_map_input_size(), options.with_map_surjective());
     } else
-      load_map<LinearMap>(map, options);
+      load_map<LinearMap>(map, options, "LinearMap");
     return map;
   }
 
@@ -125,7 +138,7 @@ make_map(const HncoOptions& options, int bv_size)
         throw std::runtime_error("make_map: map_input_size must be positive");
       map->random(bv_size, options.get_map_input_size(), options.with_map_surjective());
     } else
-      load_map<AffineMap>(map, options);
+      load_map<AffineMap>(map, options, "AffineMap");
     return map;
   }
 
@@ -138,7 +151,7 @@ make_map(const HncoOptions& options, int bv_size)
                   options.get_map_ts_length(),
                   options.get_map_ts_sampling_mode());
     } else
-      load_map<TsAffineMap>(map, options);
+      load_map<TsAffineMap>(map, options, "TsAffineMap");
     return map;
   }
 
@@ -253,6 +266,15 @@ DecoratedFunctionFactory::make_function_modifier()
 }
 
 
+Function *
+DecoratedFunctionFactory::make_on_budget_function(Function *function)
+{
+  auto controller = new OnBudgetFunction(function, _options.get_budget());
+  controller->set_stop_token(&_stop_token);
+  return controller;
+}
+
+
 Function *
 DecoratedFunctionFactory::make_function_controller(Function *function)
 {
@@ -261,6 +283,11 @@ DecoratedFunctionFactory::make_function_controller(Function *function)
   _tracker = new ProgressTracker(function);
   _tracker->set_log_improvement(_options.with_log_improvement());
   _tracker->set_record_evaluation_time(_options.with_record_evaluation_time());
+  if (_options.with_save_trace()) {
+    _tracker->set_record_trace(true);
+    if (_options.with_trace_bit_vectors())
+      _tracker->set_record_bit_vector(true);
+  }
 
   function = _tracker;
 
@@ -269,7 +296,7 @@ DecoratedFunctionFactory::make_function_controller(Function *function)
   //
 
   if (_options.get_budget() > 0 && !_options.with_cache()) {
-    function = new OnBudgetFunction(function, _options.get_budget());
+    function = make_on_budget_function(function);
   }
 
   if (_options.get_budget() <= 0 && _options.with_cache()) {
@@ -280,9 +307,9 @@ DecoratedFunctionFactory::make_function_controller(Function *function)
   if (_options.get_budget() > 0 && _options.with_cache()) {
     if (_options.with_cache_budget()) {
       _cache = new Cache(function);
-      function = new OnBudgetFunction(_cache, _options.get_budget());
+      function = make_on_budget_function(_cache);
     } else {
-      function = new OnBudgetFunction(function, _options.get_budget());
+      function = make_on_budget_function(function);
       _cache = new Cache(function);
       function = _cache;
     }
@@ -296,6 +323,7 @@ DecoratedFunctionFactory::make_function_controller(Function *function)
     // Requires known maximum
     if (function->has_known_maximum()) {
       _stop_on_target = new StopOnMaximum(function);
+      _stop_on_target->set_stop_token(&_stop_token);
       function = _stop_on_target;
     } else {
       throw std::runtime_error("DecoratedFunctionFactory::make_function_controller (StopOnMaximum): Unknown maximum");
@@ -303,6 +331,7 @@ DecoratedFunctionFactory::make_function_controller(Function *function)
   } else {
     if (_options.with_target()) {
       _stop_on_target = new StopOnTarget(function, _options.get_target());
+      _stop_on_target->set_stop_token(&_stop_token);
       function = _stop_on_target;
     }
   }
@@ -52,6 +52,12 @@ class DecoratedFunctionFactory {
   /// StopOnTarget controller
   hnco::function::controller::StopOnTarget *_stop_on_target = nullptr;
 
+  /// Stop token shared by OnBudgetFunction and StopOnTarget controllers
+  hnco::StopToken _stop_token;
+
+  /// Make an OnBudgetFunction controller
+  hnco::function::Function *make_on_budget_function(hnco::function::Function *function);
+
   /// Make a function
   hnco::function::Function *make_function();
 
@@ -209,12 +209,16 @@ CommandLineFunctionFactory::make()
     case 0: {
       using Rep = IntegerCategoricalRepresentation;
       auto reps = std::vector<Rep>(instance->get_num_variables(), Rep(9));
-      return new MultivariateFunctionAdapter<Fn, Rep, Conv>(instance, reps);
+      auto fn = new MultivariateFunctionAdapter<Fn, Rep, Conv>(instance, reps);
+      fn->set_memo(_options.with_rep_memo());
+      return fn;
     }
     case 1: {
       using Rep = LinearCategoricalRepresentation;
       auto reps = std::vector<Rep>(instance->get_num_variables(), Rep(9));
-      return new MultivariateFunctionAdapter<Fn, Rep, Conv>(instance, reps);
+      auto fn = new MultivariateFunctionAdapter<Fn, Rep, Conv>(instance, reps);
+      fn->set_memo(_options.with_rep_memo());
+      return fn;
     }
     default:
       fail_with("CommandLineFunctionFactory::make: Unknown categorical representation type: ",
@@ -236,7 +240,9 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicFloatRepresentation<double>;
     using Conv    = ScalarToDouble<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 501: {
@@ -244,7 +250,9 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicIntegerRepresentation<long>;
     using Conv    = ScalarToDouble<long>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 502: {
@@ -252,7 +260,9 @@ CommandLineFunctionFactory::make()
     using Rep     = ComplexRepresentation<DoubleRep>;
     using Conv    = SquaredMagnitude<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter_complex<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter_complex<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 503: {
@@ -260,14 +270,18 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicIntegerRepresentation<int>;
     using Conv    = ScalarToDouble<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 504: {
     using Fn      = ParsedMultivariateFunction<FunctionParser>;
     using Conv    = ScalarToDouble<double>;
     using Adapter = MixedRepresentationMultivariateFunctionAdapter<Fn, rep_var_t, Conv>;
-    return make_mixed_type_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_mixed_type_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 510: {
@@ -275,7 +289,9 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicFloatRepresentation<double>;
     using Conv    = OppositeAbsoluteValue<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 511: {
@@ -283,7 +299,9 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicIntegerRepresentation<long>;
     using Conv    = OppositeAbsoluteValue<long>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 512: {
@@ -291,7 +309,9 @@ CommandLineFunctionFactory::make()
     using Rep     = ComplexRepresentation<DoubleRep>;
     using Conv    = OppositeSquaredMagnitude<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter_complex<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter_complex<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 513: {
@@ -299,14 +319,18 @@ CommandLineFunctionFactory::make()
     using Rep     = DyadicIntegerRepresentation<int>;
     using Conv    = OppositeAbsoluteValue<double>;
     using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
-    return make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 514: {
     using Fn      = ParsedMultivariateFunction<FunctionParser>;
     using Conv    = OppositeAbsoluteValue<double>;
     using Adapter = MixedRepresentationMultivariateFunctionAdapter<Fn, rep_var_t, Conv>;
-    return make_mixed_type_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    auto fn = make_mixed_type_multivariate_function_adapter<HncoOptions, Adapter>(_options);
+    fn->set_memo(_options.with_rep_memo());
+    return fn;
   }
 
   case 520: {
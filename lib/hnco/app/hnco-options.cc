@@ -36,6 +36,8 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
     {"fn-num-traps", required_argument, 0, OPTION_FN_NUM_TRAPS},
     {"fn-prefix-length", required_argument, 0, OPTION_FN_PREFIX_LENGTH},
     {"fn-threshold", required_argument, 0, OPTION_FN_THRESHOLD},
+    {"fn-walsh-transform-num-terms", required_argument, 0, OPTION_FN_WALSH_TRANSFORM_NUM_TERMS},
+    {"fn-walsh-transform-path", required_argument, 0, OPTION_FN_WALSH_TRANSFORM_PATH},
     {"fp-default-double-precision", required_argument, 0, OPTION_FP_DEFAULT_DOUBLE_PRECISION},
     {"fp-default-double-rep", required_argument, 0, OPTION_FP_DEFAULT_DOUBLE_REP},
     {"fp-default-double-size", required_argument, 0, OPTION_FP_DEFAULT_DOUBLE_SIZE},
@@ -86,6 +88,7 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
     {"selection-size", required_argument, 0, OPTION_SELECTION_SIZE},
     {"solution-path", required_argument, 0, OPTION_SOLUTION_PATH},
     {"target", required_argument, 0, OPTION_TARGET},
+    {"trace-path", required_argument, 0, OPTION_TRACE_PATH},
     {"additive-gaussian-noise", no_argument, 0, OPTION_ADDITIVE_GAUSSIAN_NOISE},
     {"bm-log-norm-1", no_argument, 0, OPTION_BM_LOG_NORM_1},
     {"bm-log-norm-infinite", no_argument, 0, OPTION_BM_LOG_NORM_INFINITE},
@@ -126,13 +129,17 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
     {"pv-log-pv", no_argument, 0, OPTION_PV_LOG_PV},
     {"record-evaluation-time", no_argument, 0, OPTION_RECORD_EVALUATION_TIME},
     {"record-total-time", no_argument, 0, OPTION_RECORD_TOTAL_TIME},
+    {"rep-memo", no_argument, 0, OPTION_REP_MEMO},
     {"restart", no_argument, 0, OPTION_RESTART},
     {"rls-strict", no_argument, 0, OPTION_RLS_STRICT},
     {"rw-log-value", no_argument, 0, OPTION_RW_LOG_VALUE},
     {"save-description", no_argument, 0, OPTION_SAVE_DESCRIPTION},
     {"save-results", no_argument, 0, OPTION_SAVE_RESULTS},
     {"save-solution", no_argument, 0, OPTION_SAVE_SOLUTION},
+    {"save-trace", no_argument, 0, OPTION_SAVE_TRACE},
     {"stop-on-maximum", no_argument, 0, OPTION_STOP_ON_MAXIMUM},
+    {"trace-binary", no_argument, 0, OPTION_TRACE_BINARY},
+    {"trace-bit-vectors", no_argument, 0, OPTION_TRACE_BIT_VECTORS},
     {"version", no_argument, 0, OPTION_VERSION},
     {"help", no_argument, 0, OPTION_HELP},
     {"help-fn", no_argument, 0, OPTION_HELP_FN},
@@ -288,6 +295,16 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
       _fn_threshold = std::atoi(optarg);
       break;
 
+    case OPTION_FN_WALSH_TRANSFORM_NUM_TERMS:
+      _with_fn_walsh_transform_num_terms = true;
+      _fn_walsh_transform_num_terms = std::atoi(optarg);
+      break;
+
+    case OPTION_FN_WALSH_TRANSFORM_PATH:
+      _with_fn_walsh_transform_path = true;
+      _fn_walsh_transform_path = std::string(optarg);
+      break;
+
     case OPTION_FP_DEFAULT_DOUBLE_PRECISION:
       _with_fp_default_double_precision = true;
       _fp_default_double_precision = std::atof(optarg);
@@ -554,6 +571,11 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
       _target = std::atof(optarg);
       break;
 
+    case OPTION_TRACE_PATH:
+      _with_trace_path = true;
+      _trace_path = std::string(optarg);
+      break;
+
     case OPTION_ADDITIVE_GAUSSIAN_NOISE:
       _additive_gaussian_noise = true;
       break;
@@ -714,6 +736,10 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
       _record_total_time = true;
       break;
 
+    case OPTION_REP_MEMO:
+      _rep_memo = true;
+      break;
+
     case OPTION_RESTART:
       _restart = true;
       break;
@@ -738,10 +764,22 @@ HncoOptions::HncoOptions(int argc, char *argv[], bool ignore_bad_options):
       _save_solution = true;
       break;
 
+    case OPTION_SAVE_TRACE:
+      _save_trace = true;
+      break;
+
     case OPTION_STOP_ON_MAXIMUM:
       _stop_on_maximum = true;
       break;
 
+    case OPTION_TRACE_BINARY:
+      _trace_binary = true;
+      break;
+
+    case OPTION_TRACE_BIT_VECTORS:
+      _trace_bit_vectors = true;
+      break;
+
     case OPTION_HELP:
       print_help(std::cerr);
       exit(0);
@@ -911,6 +949,10 @@ void HncoOptions::print_help_fn(std::ostream& stream) const
   stream << "          Threshold (in bits) for Jump, Four Peaks, and Six Peaks" << std::endl;
   stream << "      --fn-walsh-transform" << std::endl;
   stream << "          Compute the Walsh transform of the function" << std::endl;
+  stream << "      --fn-walsh-transform-num-terms (type int, default to 0)" << std::endl;
+  stream << "          Number of Walsh terms with the largest amplitudes to print (0 means all, must be positive with a path)" << std::endl;
+  stream << "      --fn-walsh-transform-path (type string, no default)" << std::endl;
+  stream << "          Path of a file in which to store the Walsh transform (out of core computation)" << std::endl;
   stream << "  -F, --function (type int, default to 0)" << std::endl;
   stream << "          Type of function" << std::endl;
   stream << "            0: OneMax" << std::endl;
@@ -1005,6 +1047,8 @@ void HncoOptions::print_help_rep(std::ostream& stream) const
   stream << "          Categorical representation" << std::endl;
   stream << "            0: Integer" << std::endl;
   stream << "            1: Linear" << std::endl;
+  stream << "      --rep-memo" << std::endl;
+  stream << "          Only unpack variables which have changed since the last evaluation" << std::endl;
   stream << "      --rep-num-additional-bits (type int, default to 2)" << std::endl;
   stream << "          Number of additional bits per element for permutation representation" << std::endl;
   stream << std::endl;
@@ -1043,10 +1087,18 @@ void HncoOptions::print_help_ctrl(std::ostream& stream) const
   stream << "          Log improvement" << std::endl;
   stream << "      --record-evaluation-time" << std::endl;
   stream << "          Record evaluation time" << std::endl;
+  stream << "      --save-trace" << std::endl;
+  stream << "          Save the improvement trace in a file" << std::endl;
   stream << "      --stop-on-maximum" << std::endl;
   stream << "          Stop on maximum" << std::endl;
   stream << "      --target (type double, no default)" << std::endl;
   stream << "          Set a target" << std::endl;
+  stream << "      --trace-binary" << std::endl;
+  stream << "          Save the improvement trace in binary format" << std::endl;
+  stream << "      --trace-bit-vectors" << std::endl;
+  stream << "          Record the bit vectors in the improvement trace (delta-encoded)" << std::endl;
+  stream << "      --trace-path (type string, default to \"trace.csv\")" << std::endl;
+  stream << "          Path of the improvement trace file" << std::endl;
   stream << std::endl;
 }
 
@@ -1127,10 +1179,12 @@ void HncoOptions::print_help_alg(std::ostream& stream) const
   stream << "            300: (1+1) evolutionary algorithm (EA)" << std::endl;
   stream << "            301: Self-adjusting (1+1) evolutionary algorithm (EA)" << std::endl;
   stream << "            310: (mu+lambda) evolutionary algorithm (EA)" << std::endl;
+  stream << "            315: (mu+1) evolutionary algorithm (EA), asynchronous with several threads" << std::endl;
   stream << "            320: (mu,lambda) evolutionary algorithm (EA)" << std::endl;
   stream << "            330: Two-rate (1+lambda) evolutionary algorithm (EA)" << std::endl;
   stream << "            340: Information-theoretic evolutionary algorithm (EA)" << std::endl;
   stream << "            400: Genetic algorithm (GA)" << std::endl;
+  stream << "            410: Steady-state genetic algorithm (GA), asynchronous with several threads" << std::endl;
   stream << "            450: (1+(lambda,lambda)) genetic algorithm (GA)" << std::endl;
   stream << "            500: Population-based incremental learning (PBIL)" << std::endl;
   stream << "            501: PBIL with negative and positive selection" << std::endl;
@@ -1372,6 +1426,9 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const HncoOptions& opt
   stream << "# fn_num_traps = " << options._fn_num_traps << std::endl;
   stream << "# fn_prefix_length = " << options._fn_prefix_length << std::endl;
   stream << "# fn_threshold = " << options._fn_threshold << std::endl;
+  stream << "# fn_walsh_transform_num_terms = " << options._fn_walsh_transform_num_terms << std::endl;
+  if (options._with_fn_walsh_transform_path)
+    stream << "# fn_walsh_transform_path = \"" << options._fn_walsh_transform_path << "\"" << std::endl;
   if (options._with_fp_default_double_precision)
     stream << "# fp_default_double_precision = " << options._fp_default_double_precision << std::endl;
   stream << "# fp_default_double_rep = \"" << options._fp_default_double_rep << "\"" << std::endl;
@@ -1429,6 +1486,7 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const HncoOptions& opt
   stream << "# solution_path = \"" << options._solution_path << "\"" << std::endl;
   if (options._with_target)
     stream << "# target = " << options._target << std::endl;
+  stream << "# trace_path = \"" << options._trace_path << "\"" << std::endl;
   if (options._additive_gaussian_noise)
     stream << "# additive_gaussian_noise " << std::endl;
   if (options._bm_log_norm_1)
@@ -1509,6 +1567,8 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const HncoOptions& opt
     stream << "# record_evaluation_time " << std::endl;
   if (options._record_total_time)
     stream << "# record_total_time " << std::endl;
+  if (options._rep_memo)
+    stream << "# rep_memo " << std::endl;
   if (options._restart)
     stream << "# restart " << std::endl;
   if (options._rls_strict)
@@ -1521,8 +1581,14 @@ std::ostream& hnco::app::operator<<(std::ostream& stream, const HncoOptions& opt
     stream << "# save_results " << std::endl;
   if (options._save_solution)
     stream << "# save_solution " << std::endl;
+  if (options._save_trace)
+    stream << "# save_trace " << std::endl;
   if (options._stop_on_maximum)
     stream << "# stop_on_maximum " << std::endl;
+  if (options._trace_binary)
+    stream << "# trace_binary " << std::endl;
+  if (options._trace_bit_vectors)
+    stream << "# trace_bit_vectors " << std::endl;
   stream << "# last_parameter" << std::endl;
   stream << "# exec_name = " << options._exec_name << std::endl;
   stream << "# version = " << options._version << std::endl;
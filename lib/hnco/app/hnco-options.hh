@@ -58,6 +58,8 @@ class HncoOptions {
     OPTION_FN_NUM_TRAPS,
     OPTION_FN_PREFIX_LENGTH,
     OPTION_FN_THRESHOLD,
+    OPTION_FN_WALSH_TRANSFORM_NUM_TERMS,
+    OPTION_FN_WALSH_TRANSFORM_PATH,
     OPTION_FP_DEFAULT_DOUBLE_PRECISION,
     OPTION_FP_DEFAULT_DOUBLE_REP,
     OPTION_FP_DEFAULT_DOUBLE_SIZE,
@@ -108,6 +110,7 @@ class HncoOptions {
     OPTION_SELECTION_SIZE,
     OPTION_SOLUTION_PATH,
     OPTION_TARGET,
+    OPTION_TRACE_PATH,
     OPTION_ADDITIVE_GAUSSIAN_NOISE,
     OPTION_BM_LOG_NORM_1,
     OPTION_BM_LOG_NORM_INFINITE,
@@ -148,13 +151,17 @@ class HncoOptions {
     OPTION_PV_LOG_PV,
     OPTION_RECORD_EVALUATION_TIME,
     OPTION_RECORD_TOTAL_TIME,
+    OPTION_REP_MEMO,
     OPTION_RESTART,
     OPTION_RLS_STRICT,
     OPTION_RW_LOG_VALUE,
     OPTION_SAVE_DESCRIPTION,
     OPTION_SAVE_RESULTS,
     OPTION_SAVE_SOLUTION,
-    OPTION_STOP_ON_MAXIMUM
+    OPTION_SAVE_TRACE,
+    OPTION_STOP_ON_MAXIMUM,
+    OPTION_TRACE_BINARY,
+    OPTION_TRACE_BIT_VECTORS
   };
 
   /// Type of algorithm
@@ -257,6 +264,14 @@ class HncoOptions {
   int _fn_threshold = 10;
   bool _with_fn_threshold = false;
 
+  /// Number of Walsh terms with the largest amplitudes to print (0 means all, must be positive with a path)
+  int _fn_walsh_transform_num_terms = 0;
+  bool _with_fn_walsh_transform_num_terms = false;
+
+  /// Path of a file in which to store the Walsh transform (out of core computation)
+  std::string _fn_walsh_transform_path;
+  bool _with_fn_walsh_transform_path = false;
+
   /// Default precision of double representations
   double _fp_default_double_precision;
   bool _with_fp_default_double_precision = false;
@@ -457,6 +472,10 @@ class HncoOptions {
   double _target;
   bool _with_target = false;
 
+  /// Path of the improvement trace file
+  std::string _trace_path = "trace.csv";
+  bool _with_trace_path = false;
+
   /// Additive Gaussian noise
   bool _additive_gaussian_noise = false;
 
@@ -577,6 +596,9 @@ class HncoOptions {
   /// Record total time
   bool _record_total_time = false;
 
+  /// Only unpack variables which have changed since the last evaluation
+  bool _rep_memo = false;
+
   /// Restart any algorithm an indefinite number of times
   bool _restart = false;
 
@@ -595,9 +617,18 @@ class HncoOptions {
   /// Save the solution in a file
   bool _save_solution = false;
 
+  /// Save the improvement trace in a file
+  bool _save_trace = false;
+
   /// Stop on maximum
   bool _stop_on_maximum = false;
 
+  /// Save the improvement trace in binary format
+  bool _trace_binary = false;
+
+  /// Record the bit vectors in the improvement trace (delta-encoded)
+  bool _trace_bit_vectors = false;
+
   /// Print help message
   void print_help(std::ostream& stream) const;
 
@@ -819,6 +850,23 @@ public:
   /// With parameter fn_threshold
   bool with_fn_threshold() const { return _with_fn_threshold; }
 
+  /// Get the value of fn_walsh_transform_num_terms
+  int get_fn_walsh_transform_num_terms() const { return _fn_walsh_transform_num_terms; }
+
+  /// With parameter fn_walsh_transform_num_terms
+  bool with_fn_walsh_transform_num_terms() const { return _with_fn_walsh_transform_num_terms; }
+
+  /// Get the value of fn_walsh_transform_path
+  std::string get_fn_walsh_transform_path() const {
+    if (_with_fn_walsh_transform_path)
+      return _fn_walsh_transform_path;
+    else
+      throw std::runtime_error("HncoOptions::get_fn_walsh_transform_path: Parameter fn_walsh_transform_path has no default value and has not been set");
+    }
+
+  /// With parameter fn_walsh_transform_path
+  bool with_fn_walsh_transform_path() const { return _with_fn_walsh_transform_path; }
+
   /// Get the value of fp_default_double_precision
   double get_fp_default_double_precision() const {
     if (_with_fp_default_double_precision)
@@ -1154,6 +1202,12 @@ public:
   /// With parameter target
   bool with_target() const { return _with_target; }
 
+  /// Get the value of trace_path
+  std::string get_trace_path() const { return _trace_path; }
+
+  /// With parameter trace_path
+  bool with_trace_path() const { return _with_trace_path; }
+
   /// With the flag additive_gaussian_noise
   bool with_additive_gaussian_noise() const { return _additive_gaussian_noise; }
 
@@ -1274,6 +1328,9 @@ public:
   /// With the flag record_total_time
   bool with_record_total_time() const { return _record_total_time; }
 
+  /// With the flag rep_memo
+  bool with_rep_memo() const { return _rep_memo; }
+
   /// With the flag restart
   bool with_restart() const { return _restart; }
 
@@ -1292,9 +1349,18 @@ public:
   /// With the flag save_solution
   bool with_save_solution() const { return _save_solution; }
 
+  /// With the flag save_trace
+  bool with_save_trace() const { return _save_trace; }
+
   /// With the flag stop_on_maximum
   bool with_stop_on_maximum() const { return _stop_on_maximum; }
 
+  /// With the flag trace_binary
+  bool with_trace_binary() const { return _trace_binary; }
+
+  /// With the flag trace_bit_vectors
+  bool with_trace_bit_vectors() const { return _trace_bit_vectors; }
+
   friend std::ostream& operator<<(std::ostream&, const HncoOptions&);
 };
 
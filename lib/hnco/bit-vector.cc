@@ -20,8 +20,13 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::min
+#include <cstring>              // std::memcpy
 #include <string>               // std::getline
 #include <iostream>
+#include <type_traits>          // std::is_same
+
+#include "config.h"
 
 #include "util.hh"              // hnco::have_same_size
 #include "bit-vector.hh"
@@ -141,17 +146,188 @@ hnco::bv_add(bit_vector_t& dest, const bit_vector_t& x, const bit_vector_t& y)
     // dest[i] = (x[i] + y[i]) % 2;
 }
 
+namespace {
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ || __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+const std::uint64_t lsb_first_magic = 0x0102040810204080;
+const std::uint64_t msb_first_magic = 0x8040201008040201;
+#else
+const std::uint64_t lsb_first_magic = 0x8040201008040201;
+const std::uint64_t msb_first_magic = 0x0102040810204080;
+#endif
+
+/**
+ * Pack 8 bits into a byte.
+ *
+ * The 8 bytes are loaded as a single word. The multiplication by the
+ * magic number gathers the least significant bit of each byte into
+ * the most significant byte of the product.
+ *
+ * @param x Pointer to the first bit
+ * @param magic Magic number which determines the bit order
+ */
+inline std::size_t
+pack_byte(const bit_t *x, std::uint64_t magic)
+{
+  std::uint64_t word;
+  std::memcpy(&word, x, sizeof(word));
+  return (word * magic) >> 56;
+}
+
+/// Pack 8 bits into a byte, x[0] being the least significant bit
+inline std::size_t pack_byte_lsb_first(const bit_t *x) { return pack_byte(x, lsb_first_magic); }
+
+/// Pack 8 bits into a byte, x[0] being the most significant bit
+inline std::size_t pack_byte_msb_first(const bit_t *x) { return pack_byte(x, msb_first_magic); }
+
+#else
+
+inline std::size_t
+pack_byte_lsb_first(const bit_t *x)
+{
+  std::size_t result = 0;
+  for (int i = 0; i < 8; i++)
+    result |= std::size_t(x[i]) << i;
+  return result;
+}
+
+inline std::size_t
+pack_byte_msb_first(const bit_t *x)
+{
+  std::size_t result = 0;
+  for (int i = 0; i < 8; i++)
+    result = (result << 1) | x[i];
+  return result;
+}
+
+#endif
+
+/**
+ * Convert bits to a size_t, x[0] being the least significant bit.
+ * @param x Pointer to the first bit
+ * @param n Number of bits
+ */
+std::size_t
+to_size_type_lsb_first(const bit_t *x, int n)
+{
+  std::size_t result = 0;
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+    result |= pack_byte_lsb_first(x + i) << i;
+  for (; i < n; i++)
+    result |= std::size_t(x[i]) << i;
+  return result;
+}
+
+/// Eight bytes equal to one
+const std::uint64_t all_ones_bytes = 0x0101010101010101;
+
+/// Load eight bits as a single word
+inline std::uint64_t
+load_word(const bit_t *x)
+{
+  std::uint64_t word;
+  std::memcpy(&word, x, sizeof(word));
+  return word;
+}
+
+/**
+ * Hamming weight of a range of bits.
+ *
+ * Words of eight bits are added as eight byte lanes. Each lane can
+ * hold at most 255 words before its counter is folded.
+ *
+ * @param x Pointer to the first bit
+ * @param n Number of bits
+ */
+int
+hamming_weight(const bit_t *x, std::size_t n)
+{
+  int result = 0;
+  std::size_t i = 0;
+  while (i + 8 <= n) {
+    const std::size_t num_words = std::min<std::size_t>((n - i) / 8, 255);
+    std::uint64_t sum = 0;
+    for (std::size_t k = 0; k < num_words; k++, i += 8)
+      sum += load_word(x + i);
+    sum = (sum & 0x00ff00ff00ff00ff) + ((sum >> 8) & 0x00ff00ff00ff00ff);
+    result += (sum * 0x0001000100010001) >> 48;
+  }
+  for (; i < n; i++)
+    result += x[i];
+  return result;
+}
+
+/*
+ * Byte access to the storage of std::vector<bool> relies on the
+ * internals of libstdc++ (_Bit_iterator::_M_p) and on little endian
+ * words. It must be enabled with configure option
+ * --enable-vector-bool-bytes and is ignored in debug mode, whose
+ * iterators are checked wrappers. The default portable path copies
+ * one bit at a time.
+ */
+#if defined(ENABLE_VECTOR_BOOL_BYTES) && defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG) \
+  && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+/**
+ * Unpack a byte into 8 bits, the least significant bit first.
+ *
+ * The multiplication copies the byte into each byte of the word. The
+ * mask then keeps bit k in byte k. Adding 0x7f to each byte carries
+ * a nonzero byte into its most significant bit.
+ *
+ * @param b Byte
+ */
+inline std::uint64_t
+unpack_byte_lsb_first(std::uint64_t b)
+{
+  std::uint64_t word = (b * all_ones_bytes) & 0x8040201008040201;
+  return ((word + 0x7f7f7f7f7f7f7f7f) & 0x8080808080808080) >> 7;
+}
+
+/**
+ * Storage of a std::vector<bool> as bytes.
+ *
+ * libstdc++ stores bits in words, the least significant bit first,
+ * hence, on little endian architectures, byte j holds bits 8j to
+ * 8j + 7, the least significant bit first.
+ */
+inline const unsigned char *
+vector_bool_bytes(const std::vector<bool>& y)
+{
+  static_assert(std::is_same<decltype(y.begin()._M_p), std::_Bit_type *>::value,
+                "vector_bool_bytes: unexpected std::vector<bool> storage");
+  return reinterpret_cast<const unsigned char *>(y.begin()._M_p);
+}
+
+/// Storage of a std::vector<bool> as bytes
+inline unsigned char *
+vector_bool_bytes(std::vector<bool>& y)
+{
+  return reinterpret_cast<unsigned char *>(y.begin()._M_p);
+}
+
+#define HNCO_VECTOR_BOOL_BYTES
+
+#endif
+
+}
+
 void
 hnco::bv_to_vector_bool(std::vector<bool>& y, const bit_vector_t& x)
 {
   assert(y.size() == x.size());
 
-  for (size_t i = 0; i < x.size(); i++) {
-    if (x[i])
-      y[i] = true;
-    else
-      y[i] = false;
-  }
+  std::size_t i = 0;
+#ifdef HNCO_VECTOR_BOOL_BYTES
+  unsigned char *bytes = vector_bool_bytes(y);
+  for (; i + 8 <= x.size(); i += 8)
+    bytes[i / 8] = pack_byte_lsb_first(x.data() + i);
+#endif
+  for (; i < x.size(); i++)
+    y[i] = x[i];
 }
 
 void
@@ -159,27 +335,52 @@ hnco::bv_from_vector_bool(bit_vector_t& x, const std::vector<bool>& y)
 {
   assert(y.size() == x.size());
 
-  for (size_t i = 0; i < x.size(); i++) {
-    if (y[i])
-      x[i] = 1;
-    else
-      x[i] = 0;
+  std::size_t i = 0;
+#ifdef HNCO_VECTOR_BOOL_BYTES
+  const unsigned char *bytes = vector_bool_bytes(y);
+  for (; i + 8 <= x.size(); i += 8) {
+    std::uint64_t word = unpack_byte_lsb_first(bytes[i / 8]);
+    std::memcpy(x.data() + i, &word, sizeof(word));
   }
+#endif
+  for (; i < x.size(); i++)
+    x[i] = y[i];
+}
+
+int
+hnco::bv_hamming_weight(const bit_vector_t& x)
+{
+  return hamming_weight(x.data(), x.size());
+}
+
+int
+hnco::bv_hamming_weight(const bit_vector_t& x, int start, int stop)
+{
+  assert(0 <= start && start <= stop && stop <= int(x.size()));
+  return hamming_weight(x.data() + start, stop - start);
+}
+
+std::size_t
+hnco::bv_find_first(const bit_vector_t& x, bit_t b, std::size_t start)
+{
+  assert(start <= x.size());
+
+  // Words without any bit equal to b
+  const std::uint64_t other = b ? 0 : all_ones_bytes;
+  std::size_t i = start;
+  while (i + 8 <= x.size() && load_word(x.data() + i) == other)
+    i += 8;
+  for (; i < x.size(); i++)
+    if (x[i] == b)
+      break;
+  return i;
 }
 
 std::size_t
 hnco::bv_to_size_type(const bit_vector_t& x)
 {
   assert(x.size() <= 8 * sizeof(std::size_t));
-
-  std::size_t result = 0;
-  std::size_t mask = 1;
-  for (size_t i = 0; i < x.size(); i++) {
-    if (x[i])
-      result |= mask;
-    mask <<= 1;
-  }
-  return result;
+  return to_size_type_lsb_first(x.data(), x.size());
 }
 
 std::size_t
@@ -189,13 +390,22 @@ hnco::bv_to_size_type(const bit_vector_t& x, int start, int stop)
   assert(hnco::is_in_range(stop, start + 1, x.size() + 1));
   assert((stop - start) <= int(8 * sizeof(std::size_t)));
 
+  return to_size_type_lsb_first(x.data() + start, stop - start);
+}
+
+std::size_t
+hnco::bv_to_size_type_msb_first(const bit_vector_t& x, int start, int stop)
+{
+  assert(hnco::is_in_range(start, x.size()));
+  assert(hnco::is_in_range(stop, start + 1, x.size() + 1));
+  assert((stop - start) <= int(8 * sizeof(std::size_t)));
+
   std::size_t result = 0;
-  std::size_t mask = 1;
-  for (int i = start; i < stop; i++) {
-    if (x[i])
-      result |= mask;
-    mask <<= 1;
-  }
+  int i = start;
+  for (; i + 8 <= stop; i += 8)
+    result = (result << 8) | pack_byte_msb_first(x.data() + i);
+  for (; i < stop; i++)
+    result = (result << 1) | x[i];
   return result;
 }
 
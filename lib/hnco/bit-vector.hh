@@ -106,11 +106,31 @@ inline bool bv_is_valid(const bit_vector_t& x) { return std::all_of(x.begin(), x
 inline bool bv_is_zero(const bit_vector_t& x) { return std::all_of(x.begin(), x.end(), [](bit_t b){ return b == 0; }); }
 
 /// Hamming weight
-inline int bv_hamming_weight(const bit_vector_t& x) { return std::accumulate(x.begin(), x.end(), 0); }
+int bv_hamming_weight(const bit_vector_t& x);
+
+/** Hamming weight of a slice.
+
+    @param x Bit vector
+    @param start Start bit
+    @param stop Stop bit (excluded)
+*/
+int bv_hamming_weight(const bit_vector_t& x, int start, int stop);
 
 /// Hamming weight
 int bv_hamming_weight(const std::vector<bool>& x);
 
+/** Find the first bit equal to a given value.
+
+    Bits are compared eight at a time.
+
+    @param x Bit vector
+    @param b Value
+    @param start Start bit
+    @return The index of the first bit equal to b at or after start,
+    or the size of x if there is none
+*/
+std::size_t bv_find_first(const bit_vector_t& x, bit_t b, std::size_t start = 0);
+
 /// Hamming distance between two bit vectors
 int bv_hamming_distance(const bit_vector_t& x, const bit_vector_t& y);
 
@@ -204,6 +224,24 @@ std::size_t bv_to_size_type(const bit_vector_t& x);
 */
 std::size_t bv_to_size_type(const bit_vector_t& x, int start, int stop);
 
+/** Convert a slice of a small bit vector to a size_t in reverse order.
+
+    x[start] is the most significant bit.
+
+    x[stop-1] is the least significant bit.
+
+    @param x Input bit vector
+    @param start Start bit
+    @param stop Stop bit
+
+    @return An unsigned integer representing x[stop-1], ..., x[start]
+
+    @pre start in [0, x.size())
+    @pre stop in [start+1, x.size()]
+    @pre (stop - start) <= 8 * sizeof(std::size_t)
+*/
+std::size_t bv_to_size_type_msb_first(const bit_vector_t& x, int start, int stop);
+
 /** Convert a size_t to a small bit vector.
 
     @param x Output bit vector
@@ -26,7 +26,10 @@
 #include <fstream>              // std:ifstream, std::ofstream
 #include <vector>
 
+#include <boost/serialization/vector.hpp>
+
 #include "hnco/functions/function.hh"
+#include "hnco/serialization.hh"
 
 
 namespace hnco {
@@ -38,6 +41,16 @@ class AbstractMaxSat: public Function {
 
 protected:
 
+  friend class boost::serialization::access;
+
+  /// Serialize
+  template<class Archive>
+  void serialize(Archive& ar, const unsigned int version)
+  {
+    ar & _expression;
+    ar & _num_variables;
+  }
+
   /** Expression.
 
       An expression is represented by a vector of clauses. A clause
@@ -82,10 +95,17 @@ public:
 
   /** Load instance.
 
+      Binary archives written by save_binary are detected by their
+      magic number.
+
       \param path Path of the instance to load
       \throw std::runtime_error
   */
   void load(std::string path) {
+    if (is_binary_archive(path)) {
+      load_from_binary_archive(*this, path, "MaxSat");
+      return;
+    }
     std::ifstream stream(path);
     if (!stream.good())
       throw std::runtime_error("AbstractMaxSat::load: Cannot open " + path);
@@ -104,6 +124,13 @@ public:
     save_(stream);
   }
 
+  /** Save instance in the binary format.
+
+      \param path Path of the instance to save
+      \throw std::runtime_error
+  */
+  void save_binary(std::string path) const { save_to_binary_archive(*this, path, "MaxSat"); }
+
   ///@}
 
 };
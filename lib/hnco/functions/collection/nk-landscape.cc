@@ -20,7 +20,9 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::find, std::sort
 #include <iostream>
+#include <random>               // std::seed_seq, std::uniform_int_distribution
 
 #include "hnco/random.hh"
 
@@ -30,6 +32,50 @@ using namespace hnco::function;
 using namespace hnco::random;
 
 
+void
+NkLandscape::generate_in_chunks(int n, int k, double stddev, unsigned seed, int chunk_size)
+{
+  assert(n > 0);
+  assert(k > 0);
+  assert(k < n);
+  assert(chunk_size > 0);
+
+  _neighbors.assign(n, std::vector<int>(k + 1));
+  _partial_functions.assign(n, std::vector<double>(1 << (k + 1)));
+
+  const int num_chunks = (n + chunk_size - 1) / chunk_size;
+
+#pragma omp parallel for schedule(dynamic)
+  for (int chunk = 0; chunk < num_chunks; chunk++) {
+    std::seed_seq seq{seed, unsigned(chunk)};
+    std::mt19937 engine(seq);
+    std::normal_distribution<double> normal(0, stddev);
+
+    const int last = std::min(n, (chunk + 1) * chunk_size);
+    for (int i = chunk * chunk_size; i < last; i++) {
+      std::vector<int>& neighbors = _neighbors[i];
+
+      // Floyd's algorithm over the n - 1 other sites
+      for (int j = n - 1 - k; j < n - 1; j++) {
+        int t = std::uniform_int_distribution<int>(0, j)(engine);
+        auto end = neighbors.begin() + (j - (n - 1 - k));
+        if (std::find(neighbors.begin(), end, t) == end)
+          *end = t;
+        else
+          *end = j;
+      }
+      std::sort(neighbors.begin(), neighbors.begin() + k);
+      for (int a = 0; a < k; a++)
+        if (neighbors[a] >= i)
+          neighbors[a]++;
+      neighbors[k] = i;
+
+      for (auto& value: _partial_functions[i])
+        value = normal(engine);
+    }
+  }
+}
+
 void
 NkLandscape::random_structure(int n, int k)
 {
@@ -111,6 +111,27 @@ public:
     generate(n, k, hnco::random::Generator::normal);
   }
 
+  /** Random instance generated in parallel.
+
+      Sites are divided into chunks of consecutive sites. The
+      neighbors and partial function of the sites of a chunk are
+      sampled with an engine seeded with seed and the index of the
+      chunk, hence the instance does not depend on the number of
+      threads. Neighbors are sampled with Floyd's algorithm in O(k)
+      per site instead of O(n). Partial function values are sampled
+      from the normal distribution.
+
+      The instance differs from the one generated by random or
+      generate with the same seed.
+
+      \param n Size of bit vector
+      \param k Number of neighbors per bit
+      \param stddev Standard deviation of partial function values
+      \param seed Seed
+      \param chunk_size Number of sites per chunk
+  */
+  void generate_in_chunks(int n, int k, double stddev, unsigned seed, int chunk_size);
+
   ///@}
 
 
@@ -20,8 +20,10 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::stable_sort
 #include <iostream>
 #include <sstream>              // std::ostringstream
+#include <tuple>                // std::tuple
 
 #include "hnco/exception.hh"
 #include "hnco/random.hh"
@@ -44,6 +46,9 @@ Qubo::load(std::istream& stream)
   int count_diagonal_elements = 0;
   int count_other_elements = 0;
 
+  // Elements (i, j, q_ij) in file order
+  std::vector<std::tuple<int, int, double> > triplets;
+
   while (!stream.eof()) {
     std::string line;
     getline(stream, line);
@@ -89,8 +94,6 @@ Qubo::load(std::istream& stream)
       if (iss.fail() || num_other_elements < 0)
         throw std::runtime_error("Qubo::load: p line: Bad num_other_elements");
 
-      _q = std::vector<std::vector<double> >(dimension, std::vector<double>(dimension, 0.0));
-
       spec = true;
     }
 
@@ -120,7 +123,7 @@ Qubo::load(std::istream& stream)
       if (iss.fail() || (value == 0))
         throw std::runtime_error("Qubo::load: Bad element value");
 
-      _q[i][j] = -value;
+      triplets.push_back(std::make_tuple(i, j, -value));
 
       if (i == j)
         count_diagonal_elements++;
@@ -134,27 +137,171 @@ Qubo::load(std::istream& stream)
   if (count_diagonal_elements != num_diagonal_elements)
     throw std::runtime_error("Qubo::load: Not enough diagonal elements");
 
+  // Sort by row then column. The stable sort keeps the last
+  // occurrence of a repeated element last.
+  std::stable_sort(triplets.begin(), triplets.end(),
+                   [](const std::tuple<int, int, double>& a,
+                      const std::tuple<int, int, double>& b) {
+                     return std::get<0>(a) < std::get<0>(b) ||
+                       (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+                   });
+
+  _dimension = dimension;
+  _row_offsets.assign(dimension + 1, 0);
+  _columns.clear();
+  _elements.clear();
+  for (size_t k = 0; k < triplets.size(); k++) {
+    int i = std::get<0>(triplets[k]);
+    int j = std::get<1>(triplets[k]);
+    if (k + 1 < triplets.size() &&
+        std::get<0>(triplets[k + 1]) == i &&
+        std::get<1>(triplets[k + 1]) == j)
+      continue;
+    _columns.push_back(j);
+    _elements.push_back(std::get<2>(triplets[k]));
+    _row_offsets[i + 1]++;
+  }
+  for (int i = 0; i < dimension; i++)
+    _row_offsets[i + 1] += _row_offsets[i];
+
+  compile();
+}
+
+
+void
+Qubo::compile()
+{
+  const int n = _dimension;
+
+  _diagonal.assign(n, 0.0);
+  _neighbor_offsets.assign(n + 1, 0);
+  for (int i = 0; i < n; i++)
+    for (int k = _row_offsets[i]; k < _row_offsets[i + 1]; k++) {
+      int j = _columns[k];
+      if (j == i)
+        _diagonal[i] = _elements[k];
+      else {
+        _neighbor_offsets[i + 1]++;
+        _neighbor_offsets[j + 1]++;
+      }
+    }
+  for (int i = 0; i < n; i++)
+    _neighbor_offsets[i + 1] += _neighbor_offsets[i];
+
+  _neighbors.resize(_neighbor_offsets[n]);
+  _weights.resize(_neighbor_offsets[n]);
+  std::vector<int> positions(_neighbor_offsets.begin(), _neighbor_offsets.end() - 1);
+  for (int i = 0; i < n; i++)
+    for (int k = _row_offsets[i]; k < _row_offsets[i + 1]; k++) {
+      int j = _columns[k];
+      if (j == i)
+        continue;
+      _neighbors[positions[i]] = j;
+      _weights[positions[i]++] = _elements[k];
+      _neighbors[positions[j]] = i;
+      _weights[positions[j]++] = _elements[k];
+    }
+
+  _origin.assign(n, 0);
+  _fields.resize(n);
+  _fields_valid = false;
+  _flipped.assign(n, 0);
+}
+
+
+void
+Qubo::synchronize(const bit_vector_t& x)
+{
+  assert(int(x.size()) == _dimension);
+
+  if (!_fields_valid) {
+    for (int i = 0; i < _dimension; i++) {
+      double field = _diagonal[i];
+      for (int k = _neighbor_offsets[i]; k < _neighbor_offsets[i + 1]; k++)
+        if (x[_neighbors[k]])
+          field += _weights[k];
+      _fields[i] = field;
+    }
+    _origin = x;
+    _fields_valid = true;
+    return;
+  }
+
+  for (int i = 0; i < _dimension; i++) {
+    if (x[i] == _origin[i])
+      continue;
+    for (int k = _neighbor_offsets[i]; k < _neighbor_offsets[i + 1]; k++)
+      if (x[i])
+        _fields[_neighbors[k]] += _weights[k];
+      else
+        _fields[_neighbors[k]] -= _weights[k];
+    _origin[i] = x[i];
+  }
 }
 
 
 double
 Qubo::evaluate(const bit_vector_t& x)
 {
-  assert(x.size() == _q.size());
-
-  const size_t dimension = _q.size();
+  assert(int(x.size()) == _dimension);
 
   double result = 0;
 
-  for (size_t i = 0; i < dimension; i++) {
+  for (int i = 0; i < _dimension; i++) {
     if (!x[i])
       continue;
-    auto line = _q[i];
-    result += line[i];
-    for (size_t j = i + 1; j < dimension; j++)
-      if (x[j])
-        result += line[j];
+    for (int k = _row_offsets[i]; k < _row_offsets[i + 1]; k++)
+      if (x[_columns[k]])
+        result += _elements[k];
   }
 
   return result;
 }
+
+
+double
+Qubo::evaluate_incrementally(const bit_vector_t& x,
+                             double value,
+                             const hnco::sparse_bit_vector_t& flipped_bits)
+{
+  synchronize(x);
+
+  // Flip bits one at a time, correcting local fields for the bits
+  // already flipped
+  for (auto i : flipped_bits) {
+    double field = _fields[i];
+    if (flipped_bits.size() > 1) {
+      for (int k = _neighbor_offsets[i]; k < _neighbor_offsets[i + 1]; k++) {
+        int j = _neighbors[k];
+        if (_flipped[j]) {
+          if (x[j])
+            field -= _weights[k];
+          else
+            field += _weights[k];
+        }
+      }
+      _flipped[i] = 1;
+    }
+    if (x[i])
+      value -= field;
+    else
+      value += field;
+  }
+
+  if (flipped_bits.size() > 1)
+    for (auto i : flipped_bits)
+      _flipped[i] = 0;
+
+  return value;
+}
+
+
+void
+Qubo::compute_flip_gains(const bit_vector_t& x, std::vector<double>& gains)
+{
+  synchronize(x);
+
+  gains.resize(_dimension);
+  for (int i = 0; i < _dimension; i++)
+    gains[i] = x[i] ? -_fields[i] : _fields[i];
+}
@@ -25,7 +25,10 @@
 #include <fstream>
 #include <vector>
 
+#include <boost/serialization/vector.hpp>
+
 #include "hnco/functions/function.hh"
+#include "hnco/serialization.hh"
 
 
 namespace hnco {
@@ -75,11 +78,100 @@ class Qubo: public Function {
 
 private:
 
-  /** Matrix.
+  friend class boost::serialization::access;
+
+  /// Save
+  template<class Archive>
+  void save(Archive& ar, const unsigned int version) const
+  {
+    ar & _dimension;
+    ar & _row_offsets;
+    ar & _columns;
+    ar & _elements;
+  }
+
+  /// Load
+  template<class Archive>
+  void load(Archive& ar, const unsigned int version)
+  {
+    ar & _dimension;
+    ar & _row_offsets;
+    ar & _columns;
+    ar & _elements;
+    compile();
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+  /// Dimension
+  int _dimension = 0;
+
+  /** @name Matrix
+
+      n x n upper triangular matrix stored in compressed sparse row
+      format. Columns are sorted in each row hence the diagonal
+      element, if any, comes first.
+  */
+  ///@{
+
+  /// Row offsets
+  std::vector<int> _row_offsets;
 
-      n x n upper triangular matrix.
+  /// Column indices
+  std::vector<int> _columns;
+
+  /// Non zero elements
+  std::vector<double> _elements;
+
+  ///@}
+
+  /** @name Symmetric adjacency
+
+      Used by incremental evaluation.
   */
-  std::vector<std::vector<double> > _q;
+  ///@{
+
+  /// Diagonal
+  std::vector<double> _diagonal;
+
+  /// Neighbor offsets
+  std::vector<int> _neighbor_offsets;
+
+  /// Neighbors
+  std::vector<int> _neighbors;
+
+  /// Off diagonal elements
+  std::vector<double> _weights;
+
+  ///@}
+
+  /** @name Local fields
+
+      The local field of variable i at the origin x is \f$Q_{ii} +
+      \sum_{j \neq i} Q_{ij} x_j\f$, where Q is made symmetric. It
+      is maintained incrementally when the origin changes.
+  */
+  ///@{
+
+  /// Origin of the local fields
+  bit_vector_t _origin;
+
+  /// Local fields
+  std::vector<double> _fields;
+
+  /// Validity of the local fields
+  bool _fields_valid = false;
+
+  /// Bits already flipped in evaluate_incrementally
+  bit_vector_t _flipped;
+
+  ///@}
+
+  /// Build the symmetric adjacency from the matrix
+  void compile();
+
+  /// Move the origin of the local fields to x
+  void synchronize(const bit_vector_t& x);
 
   /** Load an instance.
 
@@ -99,24 +191,55 @@ public:
 
   /** Load instance.
 
+      Binary archives written by save_binary are detected by their
+      magic number. Their elements are already negated.
+
       \param path Path of the instance to load
       \throw std::runtime_error
   */
   void load(std::string path) {
+    if (is_binary_archive(path)) {
+      load_from_binary_archive(*this, path, "Qubo");
+      return;
+    }
     std::ifstream stream(path);
     if (!stream.good())
       throw std::runtime_error("Qubo::load: Cannot open " + path);
     load(stream);
   }
 
+  /** Save instance in the binary format.
+
+      \param path Path of the instance to save
+      \throw std::runtime_error
+  */
+  void save_binary(std::string path) const { save_to_binary_archive(*this, path, "Qubo"); }
+
   ///@}
 
   /// Get bit vector size
-  int get_bv_size() const override { return _q.size(); }
+  int get_bv_size() const override { return _dimension; }
 
   /// Evaluate a bit vector
   double evaluate(const bit_vector_t&) override;
 
+  /// Incrementally evaluate a bit vector
+  double evaluate_incrementally(const bit_vector_t& x, double value, const hnco::sparse_bit_vector_t& flipped_bits) override;
+
+  /// Check for incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
+
+  /** Compute all single flip gains.
+
+      gains[i] is the difference between the value of x with bit i
+      flipped and the value of x. The cost is linear in n when x
+      differs from the previous origin in a few bits.
+
+      \param x Bit vector
+      \param gains Gains
+  */
+  void compute_flip_gains(const bit_vector_t& x, std::vector<double>& gains);
+
 };
 
 
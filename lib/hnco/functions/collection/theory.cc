@@ -20,7 +20,7 @@
 
 #include <assert.h>
 
-#include <algorithm>            // std::all_of, std::find
+#include <algorithm>            // std::min
 #include <bitset>
 
 #include "hnco/exception.hh"
@@ -52,20 +52,15 @@ OneMax::evaluate_incrementally(const bit_vector_t& x, double v, const hnco::spar
 double
 LeadingOnes::evaluate(const bit_vector_t& x)
 {
-  size_t i = 0;
-  for (;i < x.size(); i++)
-    if (x[i] == 0)
-      break;
-  return i;
+  return bv_find_first(x, 0);
 }
 
 double
 Needle::evaluate(const bit_vector_t& x)
 {
-  for (size_t i = 0; i < x.size(); i++)
-    if (x[i] == 0)
-      return 0;
-  return 1;  
+  if (bv_find_first(x, 0) < x.size())
+    return 0;
+  return 1;
 }
 
 Hiff::Hiff(int bv_size):
@@ -83,34 +78,82 @@ Hiff::Hiff(int bv_size):
     }
 }
 
+namespace {
+
+/// Bits at the start of blocks of size 2^i in a 64-bit word
+const std::uint64_t block_starts[] = {
+  0xffffffffffffffff,
+  0x5555555555555555,
+  0x1111111111111111,
+  0x0101010101010101,
+  0x0001000100010001,
+  0x0000000100000001,
+  0x0000000000000001
+};
+
+}
+
 double
 Hiff::evaluate(const bit_vector_t& x)
 {
-  double result = 0;
-  for (int i = 0, num_blocks = _bv_size, block_size = 1; i <= _depth; i++, num_blocks /= 2, block_size *= 2) {
-    bool last = true;
-    for (int j = 0, offset = 0; j < num_blocks; j++, offset += block_size) {
-      bit_t b0 = x[offset];
-      if (all_of(x.begin() + offset, x.begin() + offset + block_size, [b0](bit_t b){ return b == b0; })) {
-        result += block_size;
-        last = false;
-      }
+  assert(int(x.size()) == _bv_size);
+
+  // All blocks of size 1 are uniform
+  double result = _bv_size;
+
+  // Blocks within words
+  const int word_size = std::min(_bv_size, 64);
+  const int num_words = _bv_size / word_size;
+  const std::uint64_t mask = word_size == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << word_size) - 1;
+  _ones.resize(num_words);
+  _zeros.resize(num_words);
+  for (int w = 0; w < num_words; w++) {
+    _ones[w] = bv_to_size_type(x, w * word_size, (w + 1) * word_size);
+    _zeros[w] = ~_ones[w] & mask;
+  }
+  int block_size = 2;
+  for (int level = 1; block_size <= word_size; level++, block_size *= 2) {
+    const int half = block_size / 2;
+    int count = 0;
+    for (int w = 0; w < num_words; w++) {
+      _ones[w] &= _ones[w] >> half;
+      _zeros[w] &= _zeros[w] >> half;
+      count += std::bitset<64>((_ones[w] | _zeros[w]) & block_starts[level]).count();
     }
-    if (last)
+    if (count == 0)
+      return result;
+    result += double(block_size) * count;
+  }
+
+  // Blocks across words
+  _states.resize(num_words);
+  for (int w = 0; w < num_words; w++)
+    _states[w] = (_ones[w] & 1) ? 2 : ((_zeros[w] & 1) ? 1 : 0);
+  for (int num_blocks = num_words / 2; num_blocks > 0; num_blocks /= 2, block_size *= 2) {
+    int count = 0;
+    for (int k = 0; k < num_blocks; k++) {
+      char a = _states[2 * k];
+      char b = _states[2 * k + 1];
+      _states[k] = (a == b) ? a : 0;
+      if (_states[k])
+        count++;
+    }
+    if (count == 0)
       break;
+    result += double(block_size) * count;
   }
-  return result;  
+
+  return result;
 }
 
 
 double
 Ridge::evaluate(const bit_vector_t& x)
 {
-  bit_vector_t::const_iterator it = find(x.begin(), x.end(), 0);
+  std::size_t length = bv_find_first(x, 0);
 
-  if (all_of(it, x.end(), [](bit_t b){ return b == 0; })) {
-    int length = it - x.begin();
-    assert(bv_hamming_weight(x) == length);
+  if (bv_find_first(x, 1, length) == x.size()) {
+    assert(bv_hamming_weight(x) == int(length));
     return _bv_size + length;
   }
 
@@ -121,14 +164,14 @@ Ridge::evaluate(const bit_vector_t& x)
 double
 Plateau::evaluate(const bit_vector_t& x)
 {
-  bit_vector_t::const_iterator it = find(x.begin(), x.end(), 0);
+  std::size_t length = bv_find_first(x, 0);
 
-  if (it == x.end()) {
+  if (length == x.size()) {
     assert(bv_hamming_weight(x) == int(_bv_size));
     return _bv_size + 2;
   }
 
-  if (all_of(it, x.end(), [](bit_t b){ return b == 0; }))
+  if (bv_find_first(x, 1, length) == x.size())
     return _bv_size + 1;
 
   return _bv_size - bv_hamming_weight(x);
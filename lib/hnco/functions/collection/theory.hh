@@ -21,6 +21,9 @@
 #ifndef HNCO_FUNCTIONS_COLLECTION_THEORY_H
 #define HNCO_FUNCTIONS_COLLECTION_THEORY_H
 
+#include <cstdint>              // std::uint64_t
+#include <vector>
+
 #include "hnco/functions/function.hh"
 
 namespace hnco {
@@ -139,12 +142,21 @@ public:
  * Nature—PPSN V: 5th International Conference Amsterdam, The
  * Netherlands September 27–30, 1998 Proceedings 5 (pp. 97-106).
  * Springer Berlin Heidelberg.
+ *
+ * Blocks of up to 64 bits are checked in parallel on packed words.
+ * Larger blocks are checked by merging the states of their halves.
  */
 class Hiff: public Function {
   /// Bit vector size
   int _bv_size;
   /// Tree depth
   int _depth;
+  /// Packed bits
+  std::vector<std::uint64_t> _ones;
+  /// Packed complemented bits
+  std::vector<std::uint64_t> _zeros;
+  /// States of blocks larger than a word (0: mixed, 1: zeros, 2: ones)
+  std::vector<char> _states;
 
 public:
   /// Constructor
@@ -33,10 +33,8 @@ Trap::evaluate(const bit_vector_t& x)
   for (int i = 0, first = 0, last = _trap_size;
        i < _num_traps;
        i++, first = last, last += _trap_size) {
-    int weight = 0;
     assert(last - first == _trap_size);
-    for (int j = first; j < last; j++)
-      weight += x[j];
+    int weight = bv_hamming_weight(x, first, last);
     if (weight == _trap_size)
       result += _trap_size;
     else {
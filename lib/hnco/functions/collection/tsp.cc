@@ -18,8 +18,11 @@
 
 */
 
+#include <algorithm>            // std::sort, std::reverse, std::rotate
+#include <cmath>                // std::sqrt
 #include <iostream>
 #include <fstream>
+#include <numeric>              // std::iota
 #include <sstream>
 
 #include "tsp.hh"
@@ -28,6 +31,10 @@ using namespace hnco::function;
 
 void
 Tsp::load(std::string path) {
+  if (hnco::is_binary_archive(path)) {
+    hnco::load_from_binary_archive(*this, path, "Tsp");
+    return;
+  }
   std::ifstream stream(path);
   if (!stream.good())
     throw std::runtime_error("Tsp::load: Cannot open " + path);
@@ -103,9 +110,8 @@ Tsp::compute_distances()
   assert(_num_cities > 0);
   _xs.resize(_num_cities);
   _ys.resize(_num_cities);
-  _distances.resize(_num_cities);
-  for (int i = 0; i < _num_cities; i++)
-    _distances[i].resize(_num_cities);
+  _distances.assign(_num_cities * _num_cities, 0);
+  _nearest_neighbors.clear();
 
   switch(_edge_weight_type) {
 
@@ -125,9 +131,6 @@ Tsp::compute_distances()
 void
 Tsp::compute_distances_att()
 {
-  for (int i = 0; i < _num_cities; i++)
-    _distances[i][i] = 0;
-
   for (int i = 1; i < _num_cities; i++)
     for (int j = 0; j < i; j++) {
       float dx = _xs[i] - _xs[j];
@@ -139,24 +142,21 @@ Tsp::compute_distances_att()
         dij = tij + 1;
       else
         dij = tij;
-      _distances[i][j] = dij;
-      _distances[j][i] = dij;
+      distance(i, j) = dij;
+      distance(j, i) = dij;
     }
 }
 
 void
 Tsp::compute_distances_euc_2d()
 {
-  for (int i = 0; i < _num_cities; i++)
-    _distances[i][i] = 0;
-
   for (int i = 1; i < _num_cities; i++)
     for (int j = 0; j < i; j++) {
       float dx = _xs[i] - _xs[j];
       float dy = _ys[i] - _ys[j];
       float dij = (int)(std::sqrt(dx * dx + dy * dy) + 0.5);
-      _distances[i][j] = dij;
-      _distances[j][i] = dij;
+      distance(i, j) = dij;
+      distance(j, i) = dij;
     }
 }
 
@@ -189,14 +189,133 @@ Tsp::describe(const hnco::permutation_t& permutation, std::ostream& stream)
   stream << "last" << std::endl;
 }
 
+void
+Tsp::compute_nearest_neighbors(int k)
+{
+  assert(k > 0);
+
+  k = std::min(k, _num_cities - 1);
+  _nearest_neighbors.resize(_num_cities);
+  std::vector<int> cities;
+  for (int i = 0; i < _num_cities; i++) {
+    cities.resize(_num_cities);
+    std::iota(cities.begin(), cities.end(), 0);
+    cities.erase(cities.begin() + i);
+    auto compare = [this, i](int a, int b) { return get_distance(i, a) < get_distance(i, b); };
+    std::partial_sort(cities.begin(), cities.begin() + k, cities.end(), compare);
+    _nearest_neighbors[i].assign(cities.begin(), cities.begin() + k);
+  }
+}
+
 double
-Tsp::evaluate(const hnco::permutation_t& permutation)
+Tsp::get_length(const hnco::permutation_t& tour) const
 {
-  assert(_distances.size() > 0);
+  assert(_num_cities > 0);
+  assert(int(tour.size()) == _num_cities);
+
   double result = 0;
-  int last = _distances.size() - 1;
+  int last = _num_cities - 1;
+  const float *distances = _distances.data();
   for (int i = 0; i < last; i++)
-    result += _distances[permutation[i]][permutation[i+1]];
-  result += _distances[permutation[last]][permutation[0]];
-  return -result;
+    result += distances[tour[i] * _num_cities + tour[i + 1]];
+  result += distances[tour[last] * _num_cities + tour[0]];
+  return result;
+}
+
+double
+Tsp::get_two_opt_delta(const hnco::permutation_t& tour, int i, int j) const
+{
+  assert(int(tour.size()) == _num_cities);
+  assert(0 <= i && i < j && j < _num_cities);
+
+  int a = tour[i];
+  int b = tour[i + 1];
+  int c = tour[j];
+  int d = tour[(j + 1) % _num_cities];
+  return
+    get_distance(a, c) + get_distance(b, d) -
+    get_distance(a, b) - get_distance(c, d);
+}
+
+void
+Tsp::apply_two_opt(hnco::permutation_t& tour, int i, int j) const
+{
+  assert(0 <= i && i < j && j < _num_cities);
+  std::reverse(tour.begin() + i + 1, tour.begin() + j + 1);
+}
+
+double
+Tsp::get_or_opt_delta(const hnco::permutation_t& tour, int i, int length, int j) const
+{
+  const int n = _num_cities;
+  assert(int(tour.size()) == n);
+  assert(0 <= i && length > 0 && i + length <= n && length < n - 1);
+  assert(0 <= j && j < n);
+  assert(j < i - 1 || j >= i + length);
+  assert(j != (i - 1 + n) % n);
+
+  int p = tour[(i - 1 + n) % n];
+  int first = tour[i];
+  int last = tour[i + length - 1];
+  int q = tour[(i + length) % n];
+  int u = tour[j];
+  int v = tour[(j + 1) % n];
+  return
+    get_distance(p, q) + get_distance(u, first) + get_distance(last, v) -
+    get_distance(p, first) - get_distance(last, q) - get_distance(u, v);
+}
+
+void
+Tsp::apply_or_opt(hnco::permutation_t& tour, int i, int length, int j) const
+{
+  assert(0 <= i && length > 0 && i + length <= _num_cities);
+  assert(j < i - 1 || j >= i + length);
+
+  if (j >= i + length)
+    std::rotate(tour.begin() + i, tour.begin() + i + length, tour.begin() + j + 1);
+  else
+    std::rotate(tour.begin() + j + 1, tour.begin() + i, tour.begin() + i + length);
+}
+
+int
+Tsp::two_opt(hnco::permutation_t& tour) const
+{
+  const int n = _num_cities;
+  assert(int(tour.size()) == n);
+
+  if (n < 4)
+    return 0;
+
+  std::vector<int> positions(n);
+  for (int i = 0; i < n; i++)
+    positions[tour[i]] = i;
+
+  std::vector<int> all_cities(n);
+  std::iota(all_cities.begin(), all_cities.end(), 0);
+
+  const double epsilon = 1e-9;
+  int num_moves = 0;
+  bool improved = true;
+  while (improved) {
+    improved = false;
+    for (int a = 0; a < n; a++) {
+      const auto& candidates = _nearest_neighbors.empty() ? all_cities : _nearest_neighbors[a];
+      for (auto c : candidates) {
+        int i = positions[a];
+        int j = positions[c];
+        if (i == j)
+          continue;
+        if (i > j)
+          std::swap(i, j);
+        if (get_two_opt_delta(tour, i, j) < -epsilon) {
+          apply_two_opt(tour, i, j);
+          for (int k = i + 1; k <= j; k++)
+            positions[tour[k]] = k;
+          num_moves++;
+          improved = true;
+        }
+      }
+    }
+  }
+  return num_moves;
 }
@@ -25,8 +25,12 @@
 #include <iosfwd>
 #include <vector>
 
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
 #include "hnco/permutation.hh"  // hnco::permutation_t
 #include "hnco/random.hh"       // hnco::random::Generator::normal
+#include "hnco/serialization.hh"
 
 namespace hnco {
 namespace function {
@@ -45,7 +49,7 @@ private:
   /// Comment
   std::string _comment;
   /// Number of cities
-  int _num_cities;
+  int _num_cities = 0;
   /// Abscissas of cities
   std::vector<float> _xs;
   /// Ordinates of cities
@@ -59,8 +63,43 @@ private:
   };
   /// Edge weith type
   EdgeWeightType _edge_weight_type = EdgeWeightType::ATT;
-  /// Distances
-  std::vector<std::vector<float>> _distances;
+  /// Distances stored as a row-major matrix
+  std::vector<float> _distances;
+  /// Nearest neighbors of each city sorted by distance
+  std::vector<std::vector<int>> _nearest_neighbors;
+  /// Distance between two cities
+  float& distance(int i, int j) { return _distances[i * _num_cities + j]; }
+  friend class boost::serialization::access;
+  /// Save
+  template<class Archive>
+  void save(Archive& ar, const unsigned int version) const
+  {
+    int edge_weight_type = static_cast<int>(_edge_weight_type);
+    ar & _name;
+    ar & _comment;
+    ar & _num_cities;
+    ar & _xs;
+    ar & _ys;
+    ar & edge_weight_type;
+    ar & _distances;
+  }
+  /// Load
+  template<class Archive>
+  void load(Archive& ar, const unsigned int version)
+  {
+    int edge_weight_type;
+    ar & _name;
+    ar & _comment;
+    ar & _num_cities;
+    ar & _xs;
+    ar & _ys;
+    ar & edge_weight_type;
+    ar & _distances;
+    _edge_weight_type = static_cast<EdgeWeightType>(edge_weight_type);
+    _nearest_neighbors.clear();
+    assert(_distances.size() == std::size_t(_num_cities) * _num_cities);
+  }
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
   /**
    * @name Load and save instance
    */
@@ -97,14 +136,14 @@ public:
   template<class Generator>
   void generate(int n, Generator generator) {
     assert(n > 0);
-    _distances.resize(n);
-    for (int i = 0; i < n; i++)
-      _distances[i].resize(n);
+    _num_cities = n;
+    _distances.assign(n * n, 0);
+    _nearest_neighbors.clear();
     for (int i = 0; i < n; i++)
       for (int j = 0; j < i; j++) {
         double d = generator();
-        _distances[i][j] = d;
-        _distances[j][i] = d;
+        distance(i, j) = d;
+        distance(j, i) = d;
       }
   }
   /**
@@ -124,6 +163,10 @@ public:
   ///@{
   /**
    * Load instance.
+   *
+   * Binary archives written by save_binary are detected by their
+   * magic number. They include the distance matrix.
+   *
    * \param path Path of the instance to load
    * \throw std::runtime_error
    */
@@ -134,15 +177,81 @@ public:
    * \throw std::runtime_error
    */
   void save(std::string path) const;
+  /**
+   * Save instance in the binary format.
+   * \param path Path of the instance to save
+   * \throw std::runtime_error
+   */
+  void save_binary(std::string path) const { save_to_binary_archive(*this, path, "Tsp"); }
   ///@}
   /// Get the number of elements
-  int get_num_elements() const { return _distances.size(); }
+  int get_num_elements() const { return _num_cities; }
+  /// Get the distance between two cities
+  double get_distance(int i, int j) const { return _distances[i * _num_cities + j]; }
+  /**
+   * Compute nearest neighbors.
+   *
+   * The neighbor lists restrict the moves considered by two_opt.
+   *
+   * \param k Number of neighbors per city
+   */
+  void compute_nearest_neighbors(int k);
+  /// Get the nearest neighbors of a city
+  const std::vector<int>& get_nearest_neighbors(int city) const {
+    assert(city >= 0 && city < int(_nearest_neighbors.size()));
+    return _nearest_neighbors[city];
+  }
   /// Display the problem
   void display(std::ostream& stream) const;
   /// Describe a solution
   void describe(const hnco::permutation_t& permutation, std::ostream& stream);
   /// Evaluate a solution
-  double evaluate(const hnco::permutation_t& permutation);
+  double evaluate(const hnco::permutation_t& permutation) { return -get_length(permutation); }
+  /**
+   * @name Tour moves
+   *
+   * Tour length variations are computed in constant time from the
+   * modified edges.
+   */
+  ///@{
+  /// Get the length of a tour
+  double get_length(const hnco::permutation_t& tour) const;
+  /**
+   * Get the length variation of a 2-opt move.
+   *
+   * The move reverses tour[i+1..j], that is it replaces the edges
+   * (tour[i], tour[i+1]) and (tour[j], tour[j+1]) by (tour[i],
+   * tour[j]) and (tour[i+1], tour[j+1]).
+   *
+   * \pre 0 <= i < j < n
+   */
+  double get_two_opt_delta(const hnco::permutation_t& tour, int i, int j) const;
+  /// Apply a 2-opt move
+  void apply_two_opt(hnco::permutation_t& tour, int i, int j) const;
+  /**
+   * Get the length variation of an Or-opt move.
+   *
+   * The move takes the segment tour[i..i+length-1] out of the tour
+   * and inserts it, with the same orientation, between tour[j] and
+   * tour[j+1].
+   *
+   * \pre i + length <= n
+   * \pre j is neither in the segment nor the predecessor of tour[i]
+   */
+  double get_or_opt_delta(const hnco::permutation_t& tour, int i, int length, int j) const;
+  /// Apply an Or-opt move
+  void apply_or_opt(hnco::permutation_t& tour, int i, int length, int j) const;
+  /**
+   * Improve a tour with 2-opt moves.
+   *
+   * First improvement local search. If nearest neighbors have been
+   * computed, only the moves creating an edge between a city and one
+   * of its neighbors are considered.
+   *
+   * \return Number of applied moves
+   */
+  int two_opt(hnco::permutation_t& tour) const;
+  ///@}
 };
 
 } // end of namespace function
@@ -42,10 +42,10 @@ WalshExpansion2::resize(int n)
   _linear.resize(n);
 
   // Quadratic part
-  _quadratic.resize(n);
-  for (size_t i = 1; i < _quadratic.size(); i++)
-    _quadratic[i].resize(i);
+  _quadratic.resize(row_offset(n));
 
+  _fields.resize(n);
+  _fields_valid = false;
 }
 
 
@@ -53,7 +53,6 @@ double
 WalshExpansion2::evaluate(const bit_vector_t& s)
 {
   assert(s.size() == _linear.size());
-  assert(s.size() == _quadratic.size());
 
   double result = 0;
 
@@ -65,8 +64,8 @@ WalshExpansion2::evaluate(const bit_vector_t& s)
       result += _linear[i];
 
   // Quadratic part
-  for (size_t i = 0; i < _quadratic.size(); i++) {
-    auto& line = _quadratic[i];
+  for (size_t i = 1; i < _linear.size(); i++) {
+    const double *line = _quadratic.data() + row_offset(i);
     const bit_t b = s[i];
     for (size_t j = 0; j < i; j++)
       if (s[j] == b)
@@ -79,6 +78,85 @@ WalshExpansion2::evaluate(const bit_vector_t& s)
 }
 
 
+void
+WalshExpansion2::add_column(std::vector<double>& fields, int k, double factor) const
+{
+  const int n = _linear.size();
+  const double *line = _quadratic.data() + row_offset(k);
+  for (int j = 0; j < k; j++)
+    fields[j] += factor * line[j];
+  for (int j = k + 1; j < n; j++)
+    fields[j] += factor * _quadratic[row_offset(j) + k];
+}
+
+
+void
+WalshExpansion2::synchronize(const bit_vector_t& x)
+{
+  assert(x.size() == _linear.size());
+
+  const int n = _linear.size();
+
+  if (!_fields_valid) {
+    _fields = _linear;
+    for (int k = 0; k < n; k++)
+      add_column(_fields, k, x[k] ? -1 : 1);
+    _origin = x;
+    _fields_valid = true;
+    return;
+  }
+
+  for (int k = 0; k < n; k++) {
+    if (x[k] == _origin[k])
+      continue;
+    // The spin of k changes from 1 to -1 or from -1 to 1
+    add_column(_fields, k, x[k] ? -2 : 2);
+    _origin[k] = x[k];
+  }
+}
+
+
+double
+WalshExpansion2::evaluate_incrementally(const bit_vector_t& x,
+                                        double value,
+                                        const hnco::sparse_bit_vector_t& flipped_bits)
+{
+  synchronize(x);
+
+  // Flip bits one at a time, correcting local fields for the bits
+  // already flipped
+  for (size_t a = 0; a < flipped_bits.size(); a++) {
+    const int i = flipped_bits[a];
+    double field = _fields[i];
+    for (size_t b = 0; b < a; b++) {
+      const int j = flipped_bits[b];
+      if (x[j])
+        field += 2 * get_quadratic(i, j);
+      else
+        field -= 2 * get_quadratic(i, j);
+    }
+    if (x[i])
+      value += 2 * field;
+    else
+      value -= 2 * field;
+  }
+
+  return value;
+}
+
+
+void
+WalshExpansion2::compute_flip_gains(const bit_vector_t& x, std::vector<double>& gains)
+{
+  synchronize(x);
+
+  const int n = _linear.size();
+  gains.resize(n);
+  for (int i = 0; i < n; i++)
+    gains[i] = x[i] ? 2 * _fields[i] : -2 * _fields[i];
+}
+
+
 void
 WalshExpansion2::generate_ising1_long_range(int n, double alpha)
 {
@@ -90,11 +168,11 @@ WalshExpansion2::generate_ising1_long_range(int n, double alpha)
   std::fill(begin(_linear), end(_linear), 0.0);
 
   // Quadratic part
-  for (size_t i = 1; i < _quadratic.size(); i++)
+  for (size_t i = 1; i < _linear.size(); i++)
     for (size_t j = 0; j < i; j++) {
       // warning: i and j are unsigned
       assert(j < i);
-      _quadratic[i][j] = std::pow(std::fabs(i - j), -alpha);
+      _quadratic[row_offset(i) + j] = std::pow(std::fabs(i - j), -alpha);
     }
 
 }
@@ -111,12 +189,12 @@ WalshExpansion2::generate_ising1_long_range_periodic(int n, double alpha)
   std::fill(begin(_linear), end(_linear), 0.0);
 
   // Quadratic part
-  for (size_t i = 1; i < _quadratic.size(); i++)
+  for (size_t i = 1; i < _linear.size(); i++)
     for (size_t j = 0; j < i; j++) {
       // warning: i and j are unsigned
       assert(j < i);
       double d = std::fabs(i - j);
-      _quadratic[i][j] = std::pow(std::min(d, n - d), -alpha);
+      _quadratic[row_offset(i) + j] = std::pow(std::min(d, n - d), -alpha);
     }
 
 }
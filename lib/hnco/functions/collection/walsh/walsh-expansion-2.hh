@@ -21,6 +21,9 @@
 #ifndef HNCO_FUNCTIONS_WALSH_WALSH_EXPANSION_2_H
 #define HNCO_FUNCTIONS_WALSH_WALSH_EXPANSION_2_H
 
+#include <assert.h>
+
+#include <algorithm>            // std::copy
 #include <iosfwd>
 #include <vector>
 #include <fstream>
@@ -52,27 +55,87 @@ private:
 
   friend class boost::serialization::access;
 
-  /// Serialize
+  /// Save
   template<class Archive>
-  void serialize(Archive& ar, const unsigned int version)
+  void save(Archive& ar, const unsigned int version) const
   {
+    const int n = _linear.size();
+    std::vector<std::vector<double> > quadratic(n);
+    for (int i = 1; i < n; i++)
+      quadratic[i].assign(_quadratic.begin() + row_offset(i),
+                          _quadratic.begin() + row_offset(i) + i);
     ar & _linear;
-    ar & _quadratic;
+    ar & quadratic;
   }
 
+  /// Load
+  template<class Archive>
+  void load(Archive& ar, const unsigned int version)
+  {
+    std::vector<std::vector<double> > quadratic;
+    ar & _linear;
+    ar & quadratic;
+    assert(quadratic.size() == _linear.size());
+    resize(_linear.size());
+    for (size_t i = 1; i < quadratic.size(); i++) {
+      assert(quadratic[i].size() == i);
+      std::copy(quadratic[i].begin(), quadratic[i].end(), _quadratic.begin() + row_offset(i));
+    }
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
   /// Linear part
   std::vector<double> _linear;
 
   /** Quadratic part.
 
-      Represented as a lower triangular matrix (without its
-      diagonal).
+      Represented as a lower triangular matrix (without its diagonal)
+      packed row by row in a contiguous array.
   */
-  std::vector<std::vector<double> > _quadratic;
+  std::vector<double> _quadratic;
+
+  /** @name Local fields
+
+      The local field of variable i at the origin x is \f$a_i +
+      \sum_{j \neq i} a_{ij} (-1)^{x_j}\f$. It is maintained
+      incrementally when the origin changes.
+  */
+  ///@{
+
+  /// Origin of the local fields
+  bit_vector_t _origin;
+
+  /// Local fields
+  std::vector<double> _fields;
+
+  /// Validity of the local fields
+  bool _fields_valid = false;
+
+  ///@}
 
   /// Resize data structures
   void resize(int n);
 
+  /// Offset of a row in the quadratic part
+  static std::size_t row_offset(int i) { return std::size_t(i) * (i - 1) / 2; }
+
+  /// Get a quadratic coefficient
+  double get_quadratic(int i, int j) const {
+    assert(i != j);
+    return i > j ? _quadratic[row_offset(i) + j] : _quadratic[row_offset(j) + i];
+  }
+
+  /** Add a multiple of a column of the symmetric quadratic part.
+      \param fields Destination
+      \param k Column index
+      \param factor Factor
+  */
+  void add_column(std::vector<double>& fields, int k, double factor) const;
+
+  /// Move the origin of the local fields to x
+  void synchronize(const bit_vector_t& x);
+
 public:
 
   /// Constructor
@@ -100,9 +163,8 @@ public:
       _linear[i] = linear_gen();
 
     // Quadratic part
-    for (size_t i = 1; i < _quadratic.size(); i++)
-      for (size_t j = 0; j < i; j++)
-        _quadratic[i][j] = quadratic_gen();
+    for (size_t k = 0; k < _quadratic.size(); k++)
+      _quadratic[k] = quadratic_gen();
 
   }
 
@@ -194,11 +256,28 @@ public:
 
 
   /// Get bit vector size
-  int get_bv_size() const override { return _quadratic.size(); }
+  int get_bv_size() const override { return _linear.size(); }
 
   /// Evaluate a bit vector
   double evaluate(const bit_vector_t&) override;
 
+  /// Incrementally evaluate a bit vector
+  double evaluate_incrementally(const bit_vector_t& x, double value, const hnco::sparse_bit_vector_t& flipped_bits) override;
+
+  /// Check for incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
+
+  /** Compute all single flip gains.
+
+      gains[i] is the difference between the value of x with bit i
+      flipped and the value of x. The cost is linear in n times the
+      number of bits in which x differs from the previous origin.
+
+      \param x Bit vector
+      \param gains Gains
+  */
+  void compute_flip_gains(const bit_vector_t& x, std::vector<double>& gains);
+
 };
 
 
@@ -20,6 +20,7 @@
 
 #include <iostream>             // std::ostream
 #include <algorithm>            // std::max_element
+#include <bitset>               // std::bitset
 
 #include "hnco/random.hh"
 
@@ -30,20 +31,151 @@ using namespace hnco::random;
 using namespace hnco::function;
 
 
+namespace {
+
+/** Density threshold of packed masks.
+
+    Masks are used if the average weight of features exceeds this
+    number of variables per 64-bit word.
+*/
+const int walsh_mask_density = 4;
+
+}
+
+
+void
+WalshExpansion::compile()
+{
+  const int n = _terms.empty() ? 0 : _terms[0].feature.size();
+  const int num_terms = _terms.size();
+
+  _coefficients.resize(num_terms);
+  _term_offsets.assign(1, 0);
+  _term_variables.clear();
+  _variable_offsets.assign(n + 1, 0);
+
+  for (int t = 0; t < num_terms; t++) {
+    const auto& feature = _terms[t].feature;
+    assert(int(feature.size()) == n);
+    _coefficients[t] = _terms[t].coefficient;
+    for (int i = 0; i < n; i++)
+      if (feature[i]) {
+        _term_variables.push_back(i);
+        _variable_offsets[i + 1]++;
+      }
+    _term_offsets.push_back(_term_variables.size());
+  }
+
+  // Reverse index
+  for (int i = 0; i < n; i++)
+    _variable_offsets[i + 1] += _variable_offsets[i];
+  _variable_terms.resize(_term_variables.size());
+  std::vector<int> positions(_variable_offsets.begin(), _variable_offsets.end() - 1);
+  for (int t = 0; t < num_terms; t++)
+    for (int k = _term_offsets[t]; k < _term_offsets[t + 1]; k++)
+      _variable_terms[positions[_term_variables[k]]++] = t;
+
+  _flip_parities.assign(num_terms, 0);
+  _touched_terms.clear();
+
+  // Packed masks for dense features
+  _num_words = (n + 63) / 64;
+  _masks.clear();
+  _packed_bv.assign(_num_words, 0);
+  if (_term_variables.size() > std::size_t(walsh_mask_density) * _num_words * num_terms) {
+    _masks.assign(std::size_t(_num_words) * num_terms, 0);
+    for (int t = 0; t < num_terms; t++) {
+      std::uint64_t *mask = &_masks[std::size_t(t) * _num_words];
+      for (int k = _term_offsets[t]; k < _term_offsets[t + 1]; k++) {
+        int i = _term_variables[k];
+        mask[i / 64] |= std::uint64_t(1) << (i % 64);
+      }
+    }
+  }
+}
+
+
+void
+WalshExpansion::pack(const bit_vector_t& x)
+{
+  const int n = x.size();
+  for (int w = 0; w < _num_words; w++)
+    _packed_bv[w] = bv_to_size_type(x, 64 * w, std::min(64 * (w + 1), n));
+}
+
+
+bool
+WalshExpansion::term_parity(const bit_vector_t& x, int term) const
+{
+  bool parity = false;
+  for (int k = _term_offsets[term]; k < _term_offsets[term + 1]; k++)
+    parity ^= bool(x[_term_variables[k]]);
+  return parity;
+}
+
+
 double
 WalshExpansion::evaluate(const bit_vector_t& x)
 {
+  const int num_terms = _coefficients.size();
   double result = 0;
-  for (size_t i = 0; i < _terms.size(); i++) {
-    if (bv_dot_product(x, _terms[i].feature))
-      result -= _terms[i].coefficient;
-    else
-      result += _terms[i].coefficient;
+
+  if (_masks.empty()) {
+    for (int t = 0; t < num_terms; t++) {
+      if (term_parity(x, t))
+        result -= _coefficients[t];
+      else
+        result += _coefficients[t];
+    }
+  } else {
+    pack(x);
+    const std::uint64_t *mask = _masks.data();
+    for (int t = 0; t < num_terms; t++, mask += _num_words) {
+      std::uint64_t word = 0;
+      for (int w = 0; w < _num_words; w++)
+        word ^= mask[w] & _packed_bv[w];
+      if (std::bitset<64>(word).count() & 1)
+        result -= _coefficients[t];
+      else
+        result += _coefficients[t];
+    }
   }
+
   return result;
 }
 
 
+double
+WalshExpansion::evaluate_incrementally(const bit_vector_t& x,
+                                       double value,
+                                       const hnco::sparse_bit_vector_t& flipped_bits)
+{
+  // A term changes sign iff an odd number of its variables are flipped
+  for (auto i : flipped_bits)
+    for (int k = _variable_offsets[i]; k < _variable_offsets[i + 1]; k++) {
+      int t = _variable_terms[k];
+      if (!_flip_parities[t]) {
+        _touched_terms.push_back(t);
+        _flip_parities[t] = 2;
+      }
+      _flip_parities[t] ^= 1;
+    }
+
+  for (auto t : _touched_terms) {
+    if (_flip_parities[t] & 1) {
+      if (term_parity(x, t))
+        value += 2 * _coefficients[t];
+      else
+        value -= 2 * _coefficients[t];
+    }
+    _flip_parities[t] = 0;
+  }
+  _touched_terms.clear();
+
+  return value;
+}
+
+
 void
 WalshExpansion::display(std::ostream& stream) const
 {
@@ -23,6 +23,7 @@
 
 #include <assert.h>
 
+#include <cstdint>              // std::uint64_t
 #include <iosfwd>
 #include <vector>
 #include <fstream>
@@ -48,6 +49,12 @@ namespace function {
     \cdot u = \sum_i x_i u_i \f$ is mod 2. The real numbers \f$ a_u
     \f$ are the coefficients of the expansion and the bit vectors
     \f$ u \f$ are its feature vectors.
+
+    Terms are compiled into a flat index whenever they change. Sparse
+    features are stored as lists of variables in compressed sparse
+    row format. Dense features are stored as packed 64-bit masks. A
+    reverse index from variables to terms provides incremental
+    evaluation.
 */
 class WalshExpansion: public Function {
 
@@ -57,14 +64,75 @@ private:
 
   /// Save
   template<class Archive>
-  void serialize(Archive& ar, const unsigned int version)
+  void save(Archive& ar, const unsigned int version) const
+  {
+    ar & _terms;
+  }
+
+  /// Load
+  template<class Archive>
+  void load(Archive& ar, const unsigned int version)
   {
     ar & _terms;
+    compile();
   }
 
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
   /// Terms
   std::vector<function::WalshTerm> _terms;
 
+  /** @name Compiled terms
+   */
+  ///@{
+
+  /// Coefficients
+  std::vector<double> _coefficients;
+
+  /// Offsets of the variable lists of terms
+  std::vector<int> _term_offsets;
+
+  /// Variables of all terms (sparse features)
+  std::vector<int> _term_variables;
+
+  /// Number of 64-bit words per mask
+  int _num_words = 0;
+
+  /// Masks of all terms (dense features)
+  std::vector<std::uint64_t> _masks;
+
+  /// Packed bit vector
+  std::vector<std::uint64_t> _packed_bv;
+
+  /// Offsets of the term lists of variables
+  std::vector<int> _variable_offsets;
+
+  /// Terms of all variables
+  std::vector<int> _variable_terms;
+
+  /** Flip parities of terms.
+
+      Bit 0 is the parity of the number of flipped variables. Bit 1
+      is set once the term has been touched.
+  */
+  std::vector<char> _flip_parities;
+
+  /// Terms touched by flipped bits
+  std::vector<int> _touched_terms;
+
+  /// Compile terms
+  void compile();
+
+  /// Pack a bit vector into 64-bit words
+  void pack(const bit_vector_t& x);
+
+  /** Sign of a term.
+      \return true if the dot product of x and the feature is odd
+  */
+  bool term_parity(const bit_vector_t& x, int term) const;
+
+  ///@}
+
 public:
 
   /// Constructor
@@ -99,6 +167,7 @@ public:
       t.coefficient = generator();
     }
 
+    compile();
   }
 
   /** Random instance.
@@ -148,11 +217,20 @@ public:
   /// Evaluate a bit vector
   double evaluate(const bit_vector_t&) override;
 
+  /// Incrementally evaluate a bit vector
+  double evaluate_incrementally(const bit_vector_t& x, double value, const hnco::sparse_bit_vector_t& flipped_bits) override;
+
+  /// Check for incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
+
   /// Display
   void display(std::ostream& stream) const override;
 
   /// Set terms
-  void set_terms(const std::vector<function::WalshTerm> terms) { _terms = terms; }
+  void set_terms(const std::vector<function::WalshTerm> terms) {
+    _terms = terms;
+    compile();
+  }
 
 };
 
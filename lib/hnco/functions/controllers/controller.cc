@@ -18,7 +18,13 @@
 
 */
 
+#include <algorithm>            // std::min, std::sort, std::set_symmetric_difference
+#include <cstdint>              // std::int32_t, std::int64_t
+#include <iterator>             // std::back_inserter
+#include <limits>               // std::numeric_limits
+
 #include "hnco/logging/logger.hh"
+#include "hnco/util.hh"         // hnco::is_in_range
 
 #include "controller.hh"
 
@@ -27,14 +33,26 @@ using namespace hnco::exception;
 using namespace hnco::function;
 using namespace hnco::function::controller;
 
+void
+StopOnTarget::stop()
+{
+  if (_stop_token) {
+    _target_reached = true;
+    _stop_token->request_stop();
+  } else
+    throw TargetReached();
+}
+
 double
 StopOnTarget::evaluate(const bit_vector_t& bv)
 {
+  if (_target_reached)
+    throw TargetReached();
   double value = _function->evaluate(bv);
   if (value >= _target) {
     _trigger.first = bv;
     _trigger.second = value;
-    throw TargetReached();
+    stop();
   }
   return value;
 }
@@ -42,11 +60,14 @@ StopOnTarget::evaluate(const bit_vector_t& bv)
 double
 StopOnTarget::evaluate_incrementally(const bit_vector_t& bv, double value, const hnco::sparse_bit_vector_t& flipped_bits)
 {
+  if (_target_reached)
+    throw TargetReached();
   double result = _function->evaluate_incrementally(bv, value, flipped_bits);
   if (result >= _target) {
     _trigger.first = bv;
+    bv_flip(_trigger.first, flipped_bits);
     _trigger.second = result;
-    throw TargetReached();
+    stop();
   }
   return result;
 }
@@ -54,11 +75,26 @@ StopOnTarget::evaluate_incrementally(const bit_vector_t& bv, double value, const
 void
 StopOnTarget::update(const bit_vector_t& bv, double value)
 {
+  if (_target_reached)
+    throw TargetReached();
   _function->update(bv, value);
   if (value >= _target) {
     _trigger.first = bv;
     _trigger.second = value;
+    stop();
+  }
+}
+
+void
+StopOnTarget::update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position)
+{
+  if (_target_reached)
     throw TargetReached();
+  _function->update_batch(bv, value, num_evaluations, position);
+  if (value >= _target) {
+    _trigger.first = bv;
+    _trigger.second = value;
+    stop();
   }
 }
 
@@ -85,12 +121,24 @@ CallCounter::update(const bit_vector_t& bv, double value)
   _num_calls++;
 }
 
+void
+CallCounter::update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position)
+{
+  assert(num_evaluations > 0);
+  assert(is_in_range(position, num_evaluations));
+
+  _function->update_batch(bv, value, num_evaluations, position);
+  _num_calls += num_evaluations;
+}
+
 double
 OnBudgetFunction::evaluate(const bit_vector_t& bv)
 {
   if (_num_calls == _budget)
     throw LastEvaluation();
-  return CallCounter::evaluate(bv);
+  double value = CallCounter::evaluate(bv);
+  check_budget();
+  return value;
 }
 
 double
@@ -98,7 +146,9 @@ OnBudgetFunction::evaluate_incrementally(const bit_vector_t& bv, double value, c
 {
   if (_num_calls == _budget)
     throw LastEvaluation();
-  return CallCounter::evaluate_incrementally(bv, value, flipped_bits);
+  double result = CallCounter::evaluate_incrementally(bv, value, flipped_bits);
+  check_budget();
+  return result;
 }
 
 void
@@ -107,6 +157,32 @@ OnBudgetFunction::update(const bit_vector_t& bv, double value)
   if (_num_calls == _budget)
     throw LastEvaluation();
   CallCounter::update(bv, value);
+  check_budget();
+}
+
+void
+OnBudgetFunction::update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position)
+{
+  assert(num_evaluations <= _budget - _num_calls);
+
+  if (_num_calls == _budget)
+    throw LastEvaluation();
+  CallCounter::update_batch(bv, value, num_evaluations, position);
+  check_budget(num_evaluations);
+}
+
+int
+OnBudgetFunction::reserve_evaluations(int n)
+{
+  assert(n >= 0);
+  assert(_num_calls + _num_reserved <= _budget);
+
+  if (_num_calls == _budget)
+    throw LastEvaluation();
+  int k = std::min(n, _budget - _num_calls - _num_reserved);
+  k = _function->reserve_evaluations(k);
+  _num_reserved += k;
+  return k;
 }
 
 double
@@ -128,7 +204,8 @@ double
 ProgressTracker::evaluate_incrementally(const bit_vector_t& bv, double value, const hnco::sparse_bit_vector_t& flipped_bits)
 {
   double result = CallCounter::evaluate_incrementally(bv, value, flipped_bits);
-  update_last_improvement(bv, result);
+  if (_num_calls == 1 || result > _last_improvement.solution.second)
+    update_last_improvement_details(bv, result, flipped_bits, _num_calls);
   return result;
 }
 
@@ -139,26 +216,137 @@ ProgressTracker::update(const bit_vector_t& bv, double value)
   update_last_improvement(bv, value);
 }
 
+void
+ProgressTracker::update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position)
+{
+  const int num_calls = _num_calls;
+  CallCounter::update_batch(bv, value, num_evaluations, position);
+  if (num_calls == 0 || value > _last_improvement.solution.second)
+    update_last_improvement_details(bv, value, sparse_bit_vector_t(), num_calls + position + 1);
+}
+
 void
 ProgressTracker::update_last_improvement(const bit_vector_t& bv, double value)
 {
   if (_num_calls == 1) {
-    update_last_improvement_details(bv, value);
+    update_last_improvement_details(bv, value, sparse_bit_vector_t(), _num_calls);
   } else if (value > _last_improvement.solution.second) {
     assert(_num_calls > 1);
-    update_last_improvement_details(bv, value);
+    update_last_improvement_details(bv, value, sparse_bit_vector_t(), _num_calls);
   }
 }
 
 void
-ProgressTracker::update_last_improvement_details(const bit_vector_t& bv, double value)
+ProgressTracker::update_last_improvement_details(const bit_vector_t& bv, double value, const sparse_bit_vector_t& flipped_bits,
+                                                 int num_evaluations)
 {
-  _last_improvement.num_evaluations = _num_calls;
-  if (_record_bit_vector)
-    _last_improvement.solution.first = bv;
+  _last_improvement.num_evaluations = num_evaluations;
   _last_improvement.solution.second = value;
+
+  if (_record_bit_vector && !_record_trace) {
+    _last_improvement.solution.first = bv;
+    bv_flip(_last_improvement.solution.first, flipped_bits);
+  } else if (_record_bit_vector) {
+    bit_vector_t& solution = _last_improvement.solution.first;
+    assert(bv.size() == solution.size());
+    _flipped_bits.clear();
+    for (int i = 0; i < int(bv.size()); i++)
+      if (bv[i] != solution[i])
+        _flipped_bits.push_back(i);
+    if (!flipped_bits.empty()) {
+      sparse_bit_vector_t sorted(flipped_bits);
+      std::sort(sorted.begin(), sorted.end());
+      sparse_bit_vector_t difference;
+      std::set_symmetric_difference(_flipped_bits.begin(), _flipped_bits.end(),
+                                    sorted.begin(), sorted.end(),
+                                    std::back_inserter(difference));
+      _flipped_bits.swap(difference);
+    }
+    bv_flip(solution, _flipped_bits);
+  }
+
+  if (_record_trace) {
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - _trace_start;
+    _trace.push_back({num_evaluations, value, time.count(), sparse_bit_vector_t()});
+    if (_record_bit_vector)
+      _trace.back().flipped_bits = _flipped_bits;
+  }
+
   if (_log_improvement) {
-    std::cout << _last_improvement << std::endl;
+    std::string line;
+    logging::append_value(line, _last_improvement.num_evaluations);
+    line += ' ';
+    logging::append_value(line, _last_improvement.solution.second);
+    logging::LogSink::get().write(line);
+  }
+}
+
+ProgressTracker::~ProgressTracker()
+{
+  if (_log_improvement)
+    logging::LogSink::get().flush();
+}
+
+void
+ProgressTracker::set_log_improvement(bool b)
+{
+  if (_log_improvement && !b)
+    logging::LogSink::get().flush();
+  _log_improvement = b;
+}
+
+void
+ProgressTracker::write_trace_csv(std::ostream& stream) const
+{
+  const auto precision = stream.precision(std::numeric_limits<double>::max_digits10);
+
+  stream << "num_evaluations,value,time";
+  if (_record_bit_vector)
+    stream << ",flipped_bits";
+  stream << "\n";
+
+  for (const auto& entry : _trace) {
+    stream << entry.num_evaluations << "," << entry.value << "," << entry.time;
+    if (_record_bit_vector) {
+      stream << ",";
+      for (size_t i = 0; i < entry.flipped_bits.size(); i++) {
+        if (i > 0)
+          stream << " ";
+        stream << entry.flipped_bits[i];
+      }
+    }
+    stream << "\n";
+  }
+
+  stream.precision(precision);
+}
+
+namespace {
+
+template<class T>
+void write_binary(std::ostream& stream, T value)
+{
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+}
+
+void
+ProgressTracker::write_trace_binary(std::ostream& stream) const
+{
+  stream.write("HNCOTRC1", 8);
+  write_binary<std::int32_t>(stream, _record_bit_vector ? get_bv_size() : 0);
+  write_binary<std::int64_t>(stream, _trace.size());
+
+  for (const auto& entry : _trace) {
+    write_binary<std::int32_t>(stream, entry.num_evaluations);
+    write_binary<double>(stream, entry.value);
+    write_binary<double>(stream, entry.time);
+    if (_record_bit_vector) {
+      write_binary<std::int32_t>(stream, entry.flipped_bits.size());
+      for (int index : entry.flipped_bits)
+        write_binary<std::int32_t>(stream, index);
+    }
   }
 }
 
@@ -22,8 +22,10 @@
 #define HNCO_FUNCTIONS_CONTROLLERS_CONTROLLER_H
 
 #include <cassert>
+#include <chrono>               // std::chrono::steady_clock
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "hnco/stop-watch.hh"
 #include "hnco/functions/decorator.hh"
@@ -40,6 +42,11 @@ namespace controller {
 /// Function controller
 class Controller: public Decorator {
 
+protected:
+
+  /// Stop token
+  StopToken *_stop_token = nullptr;
+
 public:
 
   /// Constructor
@@ -77,6 +84,37 @@ public:
   /// Safely evaluate a bit vector
   double evaluate_safely(const bit_vector_t& bv) { return _function->evaluate_safely(bv); }
 
+  /// Safely and incrementally evaluate a bit vector
+  double evaluate_incrementally_safely(const bit_vector_t& bv, double value, const hnco::sparse_bit_vector_t& flipped_bits) {
+    return _function->evaluate_incrementally_safely(bv, value, flipped_bits);
+  }
+
+  /// Reserve evaluations before a parallel evaluation
+  int reserve_evaluations(int n) override { return _function->reserve_evaluations(n); }
+
+  ///@}
+
+
+  /**
+   * @name Stop
+   */
+  ///@{
+
+  /**
+   * Set the stop token.
+   *
+   * Controllers which end a run (StopOnTarget, OnBudgetFunction)
+   * request a stop on the token instead of throwing an exception.
+   * They only throw if they are called again after the stop has been
+   * requested.
+   */
+  void set_stop_token(StopToken *token) { _stop_token = token; }
+
+  /// Get the stop token, its own or else the decorated function's
+  StopToken *get_stop_token() const override {
+    return _stop_token ? _stop_token : _function->get_stop_token();
+  }
+
   ///@}
 
 };
@@ -85,7 +123,8 @@ public:
 /**
  * Stop on target. The member function eval throws an exception
  * TargetReached when the value of its decorated function reaches a
- * given target.
+ * given target. If a stop token has been set, it requests a stop
+ * instead and only throws if it is called again.
  * @warning The target is detected using the greater or equal operator
  * hence the result should be taken with care in case of non integer
  * (floating point) function values.
@@ -98,6 +137,18 @@ class StopOnTarget: public Controller {
   /// Trigger
   algorithm::solution_t _trigger;
 
+  /**
+   * Target reached. Only set when a stop token has been set, in which
+   * case later evaluations throw TargetReached until reset.
+   */
+  bool _target_reached = false;
+
+  /**
+   * Stop.
+   * @throw TargetReached if no stop token has been set
+   */
+  void stop();
+
 public:
 
   /**
@@ -132,11 +183,29 @@ public:
    */
   void update(const bit_vector_t& bv, double value);
 
+  /**
+   * Update after a batch of safe evaluations.
+   * @throw TargetReached
+   */
+  void update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position);
+
   ///@}
 
   /// Get trigger
   const algorithm::solution_t& get_trigger() { return _trigger; }
 
+  /**
+   * Check whether the target has been reached. Only relevant if a
+   * stop token has been set; otherwise TargetReached is thrown.
+   */
+  bool is_target_reached() const { return _target_reached; }
+
+  /**
+   * Reset before a new run. The stop token, if any, is shared with
+   * other controllers and must be reset separately.
+   */
+  void reset() { _target_reached = false; }
+
 };
 
 
@@ -182,6 +251,9 @@ public:
   /// Update after a safe evaluation
   void update(const bit_vector_t& bv, double value);
 
+  /// Update after a batch of safe evaluations
+  void update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position);
+
   ///@}
 
 
@@ -191,12 +263,28 @@ public:
 };
 
 
-/// Function with a limited number of evaluations
+/**
+ * Function with a limited number of evaluations. If a stop token has
+ * been set, a stop is requested as soon as the budget is exhausted.
+ */
 class OnBudgetFunction: public CallCounter {
 
   /// Budget
   int _budget;
 
+  /// Number of reserved evaluations not yet consumed
+  int _num_reserved = 0;
+
+  /// Consume reservations, if any, and request a stop if the budget is exhausted
+  void check_budget(int num_evaluations = 1) {
+    if (_num_reserved > num_evaluations)
+      _num_reserved -= num_evaluations;
+    else
+      _num_reserved = 0;
+    if (_stop_token && _num_calls == _budget)
+      _stop_token->request_stop();
+  }
+
 public:
 
   /// Constructor
@@ -228,6 +316,22 @@ public:
    */
   void update(const bit_vector_t& bv, double value);
 
+  /**
+   * Update after a batch of safe evaluations. The batch must have
+   * been reserved.
+   * @throw LastEvaluation
+   */
+  void update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position);
+
+  /**
+   * Reserve evaluations before a parallel evaluation. Evaluations
+   * are granted within the budget left by counted calls and pending
+   * reservations. Each counted call consumes a pending reservation.
+   * @throw LastEvaluation if the budget has been exhausted by counted
+   * calls
+   */
+  int reserve_evaluations(int n) override;
+
   ///@}
 
 };
@@ -237,6 +341,13 @@ public:
  * Progress tracker. A %ProgressTracker is a CallCounter which keeps
  * track of the last improvement, that is its value and the number of
  * evaluations needed to reach it.
+ *
+ * It can also record the improvement trace, that is the sequence of
+ * all improvements, in memory. If bit vectors are recorded, each
+ * entry of the trace holds the bits flipped since the previous
+ * improvement, the first entry being relative to the zero bit
+ * vector. The trace can be written at the end of the run in CSV or
+ * binary format.
  */    
 class ProgressTracker: public CallCounter {
 
@@ -253,6 +364,23 @@ public:
 
   };
 
+  /// Entry of the improvement trace
+  struct TraceEntry {
+
+    /// Number of evaluations
+    int num_evaluations;
+
+    /// Value
+    double value;
+
+    /// Time in seconds since the construction of the tracker
+    double time;
+
+    /// Bits flipped since the previous entry (empty if bit vectors are not recorded)
+    sparse_bit_vector_t flipped_bits;
+
+  };
+
 protected:
 
   /// Last improvement
@@ -261,6 +389,15 @@ protected:
   /// Stop watch
   StopWatch _stop_watch;
 
+  /// Improvement trace
+  std::vector<TraceEntry> _trace;
+
+  /// Start time of the improvement trace
+  std::chrono::steady_clock::time_point _trace_start;
+
+  /// Bits flipped by the last improvement
+  sparse_bit_vector_t _flipped_bits;
+
   /**
    * @name Parameters
    */
@@ -280,13 +417,30 @@ protected:
    */
   bool _record_bit_vector = false;
 
+  /// Record the improvement trace
+  bool _record_trace = false;
+
   ///@}
 
   /// Update last improvement
   void update_last_improvement(const bit_vector_t& bv, double value);
 
-  /// Update last improvement (details)
-  void update_last_improvement_details(const bit_vector_t& bv, double value);
+  /**
+   * Update last improvement (details).
+   *
+   * The last improvement is bv with the bits in flipped_bits
+   * flipped. When bit vectors and the trace are both recorded, the
+   * recorded bit vector is updated in place by flipping the bits
+   * which differ, and the difference is stored in the trace.
+   * Otherwise, bv is simply copied.
+   *
+   * @param bv Bit vector
+   * @param value Value
+   * @param flipped_bits Flipped bits
+   * @param num_evaluations Number of evaluations needed to reach it
+   */
+  void update_last_improvement_details(const bit_vector_t& bv, double value, const sparse_bit_vector_t& flipped_bits,
+                                       int num_evaluations);
 
 public:
 
@@ -298,8 +452,12 @@ public:
 
     _last_improvement.num_evaluations = 0;
     _last_improvement.solution.first.resize(function->get_bv_size());
+    _trace_start = std::chrono::steady_clock::now();
   }
 
+  /// Destructor, flushes the log sink if improvements are logged
+  ~ProgressTracker();
+
   /**
    * @name Evaluation
    */
@@ -314,6 +472,9 @@ public:
   /// Update after a safe evaluation
   void update(const bit_vector_t& bv, double value);
 
+  /// Update after a batch of safe evaluations
+  void update_batch(const bit_vector_t& bv, double value, int num_evaluations, int position);
+
   ///@}
 
 
@@ -333,6 +494,39 @@ public:
   /// Get evaluation time
   double get_evaluation_time() { return _stop_watch.get_total_time(); }
 
+  /// Get the improvement trace
+  const std::vector<TraceEntry>& get_trace() const { return _trace; }
+
+  ///@}
+
+  /**
+   * @name Export
+   */
+  ///@{
+
+  /**
+   * Write the improvement trace in CSV format.
+   *
+   * The header line is "num_evaluations,value,time", followed by
+   * ",flipped_bits" if bit vectors are recorded. Flipped bits are
+   * separated by spaces.
+   */
+  void write_trace_csv(std::ostream& stream) const;
+
+  /**
+   * Write the improvement trace in binary format.
+   *
+   * All numbers are written in native byte order:
+   * - Header: magic "HNCOTRC1" (8 bytes), bit vector size
+   *   (std::int32_t, zero if bit vectors are not recorded), number of
+   *   entries (std::int64_t)
+   * - Entry: number of evaluations (std::int32_t), value (double),
+   *   time (double), and, if bit vectors are recorded, number of
+   *   flipped bits (std::int32_t) followed by their indices
+   *   (std::int32_t each)
+   */
+  void write_trace_binary(std::ostream& stream) const;
+
   ///@}
 
   /**
@@ -340,8 +534,14 @@ public:
    */
   ///@{
 
-  /// Log improvement
-  void set_log_improvement(bool b) { _log_improvement = b; }
+  /**
+   * Log improvement.
+   *
+   * Improvements are written to the log sink. The sink is flushed
+   * when logging stops, that is when b is false or when the tracker
+   * is destroyed.
+   */
+  void set_log_improvement(bool b);
 
   /// Record evaluation time
   void set_record_evaluation_time(bool b) { _record_evaluation_time = b; }
@@ -349,6 +549,14 @@ public:
   /// Record bit vector
   void set_record_bit_vector(bool b) { _record_bit_vector = b; }
 
+  /**
+   * Record the improvement trace.
+   *
+   * Bit vectors are stored in the trace (delta-encoded) only if they
+   * are recorded (see set_record_bit_vector).
+   */
+  void set_record_trace(bool b) { _record_trace = b; }
+
   ///@}
 
 };
@@ -406,6 +614,13 @@ public:
   /// Evaluate a bit vector
   double evaluate(const bit_vector_t&);
 
+  /**
+   * Reserve evaluations before a parallel evaluation.
+   * Grants all evaluations since updates are not forwarded to the
+   * decorated function.
+   */
+  int reserve_evaluations(int n) override { return n; }
+
   ///@}
 
   /// Get lookup ratio
@@ -18,9 +18,12 @@
 
 */
 
-#include <algorithm>            // std::copy, std::copy_backward
+#include <omp.h>                // omp_get_thread_num
+
+#include <algorithm>            // std::min
 
 #include "hnco/iterator.hh"
+#include "hnco/util.hh"         // hnco::is_in_range
 
 #include "function.hh"
 
@@ -73,44 +76,141 @@ hnco::function::compute_walsh_transform(function::Function *fn, std::vector<func
 
 }
 
+namespace {
+
+/** Block size of the fast Walsh transform.
+
+    Levels whose butterflies stay within a block are computed block by
+    block so that each block stays in cache.
+*/
+const std::size_t walsh_block_size = 1 << 12;
+
+/** Number of levels computed in a single pass over the array.
+
+    Grouping levels divides the number of passes over arrays which do
+    not fit in cache or in memory.
+*/
+const int walsh_num_grouped_levels = 4;
+
+/// Butterflies between two contiguous ranges
+inline void butterflies(double *a, double *b, std::size_t length)
+{
+#pragma omp simd
+  for (std::size_t j = 0; j < length; j++) {
+    double f0 = a[j];
+    double f1 = b[j];
+    a[j] = f0 + f1;
+    b[j] = f0 - f1;
+  }
+}
+
+/// Increment a bit vector seen as a little endian binary number
+inline void bv_increment(bit_vector_t& x)
+{
+  std::size_t i = 0;
+  for (; i < x.size() && x[i]; i++)
+    x[i] = 0;
+  if (i < x.size())
+    x[i] = 1;
+}
+
+}
+
 void
-hnco::function::compute_fast_walsh_transform(function::Function *fn, std::vector<function::WalshTerm>& terms)
+hnco::function::fast_walsh_transform(double *values, std::size_t size)
 {
-  const int n = fn->get_bv_size();
+  assert(size > 0);
+  assert((size & (size - 1)) == 0);
+
+  const std::size_t block_size = std::min(size, walsh_block_size);
+
+  // Levels within blocks
+#pragma omp parallel for schedule(static)
+  for (std::size_t start = 0; start < size; start += block_size) {
+    double *block = values + start;
+    for (std::size_t h = 1; h < block_size; h *= 2)
+      for (std::size_t i = 0; i < block_size; i += 2 * h)
+        butterflies(block + i, block + i + h, h);
+  }
 
-  std::vector<double> coefficients(1 << n, 0.0);
-  bit_vector_t x(n);
-
-  for (int k = 0; k < n; k++) {
-    ExtendedHypercubeIterator prefixes(k);
-    while (prefixes.has_next()) {
-      const auto& u = prefixes.next();
-      std::copy(u.begin(), u.end(), x.begin());
-      ExtendedHypercubeIterator suffixes(n - k - 1);
-      while (suffixes.has_next()) {
-        const auto& v = suffixes.next();
-        std::copy_backward(v.begin(), v.end(), x.end());
-        x[k] = 0;
-        size_t index0 = bv_to_size_type(x);
-        assert(index0 < coefficients.size());
-        x[k] = 1;
-        size_t index1 = bv_to_size_type(x);
-        assert(index1 < coefficients.size());
-        double f0, f1;
-        if (k == 0) {
-          x[k] = 0;
-          f0 = fn->evaluate(x);
-          x[k] = 1;
-          f1 = fn->evaluate(x);
-        } else {
-          f0 = coefficients[index0];
-          f1 = coefficients[index1];
-        }
-        coefficients[index0] = f0 + f1;
-        coefficients[index1] = f0 - f1;
+  // Levels across blocks, grouped so that each pass over the array
+  // computes up to walsh_num_grouped_levels levels
+  for (std::size_t h = block_size; h < size; ) {
+    std::size_t num_chunks = 1;
+    for (int l = 0; l < walsh_num_grouped_levels && h * num_chunks < size; l++)
+      num_chunks *= 2;
+    const std::size_t span = h * num_chunks;
+#pragma omp parallel for collapse(2) schedule(static)
+    for (std::size_t i = 0; i < size; i += span)
+      for (std::size_t j = 0; j < h; j += block_size) {
+        double *base = values + i + j;
+        for (std::size_t m = 1; m < num_chunks; m *= 2)
+          for (std::size_t c = 0; c < num_chunks; c++)
+            if (!(c & m))
+              butterflies(base + c * h, base + (c | m) * h, block_size);
       }
+    h = span;
+  }
+}
+
+void
+hnco::function::fast_walsh_transform(std::vector<double>& values)
+{
+  fast_walsh_transform(values.data(), values.size());
+}
+
+void
+hnco::function::evaluate_on_hypercube(const std::vector<Function *>& fns, double *values)
+{
+  assert(!fns.empty());
+
+  const int n = fns[0]->get_bv_size();
+  const std::size_t size = std::size_t(1) << n;
+
+#pragma omp parallel num_threads(fns.size())
+  {
+    const int k = omp_get_thread_num();
+    assert(is_in_range(k, fns.size()));
+    assert(fns[k]);
+
+    bit_vector_t x(n);
+    std::size_t next = 0;
+    bv_from_size_type(x, next);
+
+#pragma omp for schedule(static)
+    for (std::size_t i = 0; i < size; i++) {
+      if (i != next)
+        bv_from_size_type(x, i);
+      values[i] = fns[k]->evaluate_safely(x);
+      bv_increment(x);
+      next = i + 1;
     }
   }
+}
+
+void
+hnco::function::evaluate_on_hypercube(const std::vector<Function *>& fns, std::vector<double>& values)
+{
+  assert(!fns.empty());
+
+  values.resize(std::size_t(1) << fns[0]->get_bv_size());
+  evaluate_on_hypercube(fns, values.data());
+}
+
+void
+hnco::function::compute_fast_walsh_transform(const std::vector<Function *>& fns, std::vector<double>& coefficients)
+{
+  evaluate_on_hypercube(fns, coefficients);
+  fast_walsh_transform(coefficients);
+}
+
+void
+hnco::function::compute_fast_walsh_transform(function::Function *fn, std::vector<function::WalshTerm>& terms)
+{
+  const int n = fn->get_bv_size();
+
+  std::vector<double> coefficients;
+  compute_fast_walsh_transform(std::vector<Function *>{fn}, coefficients);
 
   // Only keep non zero terms
 
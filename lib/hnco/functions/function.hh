@@ -27,6 +27,7 @@
 #include "hnco/exception.hh"
 #include "hnco/neighborhoods/neighborhood-iterator.hh"
 #include "hnco/sparse-bit-vector.hh"
+#include "hnco/stop-token.hh"
 
 #include "walsh-term.hh"
 
@@ -104,12 +105,70 @@ public:
   */
   virtual double evaluate_safely(const bit_vector_t& x) { return evaluate(x); }
 
+  /** Safely and incrementally evaluate a bit vector.
+
+      Same requirements as evaluate_safely. It is used in
+      CompleteSearch::maximize inside a OMP parallel for loop.
+
+      By default, calls evaluate_incrementally.
+  */
+  virtual double evaluate_incrementally_safely(const bit_vector_t& x, double value,
+                                               const sparse_bit_vector_t& flipped_bits)
+  {
+    return evaluate_incrementally(x, value, flipped_bits);
+  }
+
   /** Update states after a safe evaluation.
 
       By default, does nothing.
   */
   virtual void update(const bit_vector_t& x, double value) {}
 
+  /** Update states after a batch of safe evaluations.
+
+      The batch is made of num_evaluations safe evaluations, the best
+      of which is x. Function controllers account for all the
+      evaluations of the batch. It is used by CompleteSearch which
+      only reports the best bit vector of each subcube.
+
+      By default, calls update with the best bit vector.
+
+      \param x Best bit vector of the batch
+      \param value Value of x
+      \param num_evaluations Number of evaluations in the batch
+      \param position Position of x in the batch, in [0, num_evaluations)
+  */
+  virtual void update_batch(const bit_vector_t& x, double value, int num_evaluations, int position) { update(x, value); }
+
+  /** Reserve evaluations before a parallel evaluation.
+
+      Each granted evaluation must be followed by a call to update.
+      Parallel evaluators only dispatch granted evaluations, hence no
+      evaluation is wasted beyond the budget.
+
+      By default, grants all evaluations.
+
+      \param n Number of evaluations to reserve
+      \return Number of granted evaluations, at most n
+  */
+  virtual int reserve_evaluations(int n) { return n; }
+
+  ///@}
+
+
+  /** @name Stop
+   */
+  ///@{
+
+  /** Get the stop token.
+
+      Algorithms check the stop token, if any, of their first
+      function to end a run without catching exceptions.
+
+      \return nullptr
+  */
+  virtual StopToken *get_stop_token() const { return nullptr; }
+
   ///@}
 
 
@@ -201,6 +260,68 @@ void compute_walsh_transform(function::Function *function,
 void compute_fast_walsh_transform(function::Function *function,
                                   std::vector<function::WalshTerm>& terms);
 
+/** Compute the Walsh transform of the function using a fast Walsh
+    transform.
+
+    The coefficient of the feature u is stored at index
+    bv_to_size_type(u). Contrary to the version computing Walsh
+    terms, all \f$2^n\f$ coefficients are kept in a contiguous array,
+    which requires \f$2^{n+3}\f$ bytes.
+
+    Function values are computed in parallel, one thread per
+    function. All functions must be copies of the same function.
+
+    \param fns Functions, one per thread
+    \param coefficients Coefficients of the Walsh transform
+*/
+void compute_fast_walsh_transform(const std::vector<Function *>& fns,
+                                  std::vector<double>& coefficients);
+
+/** Evaluate a function on the whole hypercube.
+
+    The value of x is stored at index bv_to_size_type(x). Function
+    values are computed in parallel, one thread per function, with
+    Function::evaluate_safely.
+
+    \param fns Functions, one per thread
+    \param values Function values
+*/
+void evaluate_on_hypercube(const std::vector<Function *>& fns,
+                           std::vector<double>& values);
+
+/** Evaluate a function on the whole hypercube.
+
+    Same as above but stores function values in a given array, for
+    example a memory-mapped file.
+
+    \param fns Functions, one per thread
+    \param values Array of size \f$2^n\f$
+*/
+void evaluate_on_hypercube(const std::vector<Function *>& fns,
+                           double *values);
+
+/** In-place fast Walsh transform.
+
+    Computes \f$\hat{v}_u = \sum_x v_x (-1)^{x\cdot u}\f$, where
+    indices are seen as bit vectors. The transform is not normalized,
+    hence applying it twice multiplies values by their number.
+
+    Levels are computed block by block for cache locality, with
+    OpenMP threads and SIMD butterflies. Levels across blocks are
+    grouped so that each pass over the array computes several of
+    them, which keeps the number of passes small when the array is a
+    memory-mapped file larger than the physical memory.
+
+    \param values Values
+    \param size Number of values which must be a power of 2
+*/
+void fast_walsh_transform(double *values, std::size_t size);
+
+/** In-place fast Walsh transform.
+    \param values Values whose number must be a power of 2
+*/
+void fast_walsh_transform(std::vector<double>& values);
+
 /// Check whether a bit vector is locally maximal
 bool bv_is_locally_maximal(const bit_vector_t& bv, Function& fn,
                            neighborhood::NeighborhoodIterator& it);
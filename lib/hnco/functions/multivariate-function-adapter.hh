@@ -21,6 +21,7 @@
 #ifndef HNCO_FUNCTIONS_MULTIVARIATE_FUNCTION_ADAPTER_H
 #define HNCO_FUNCTIONS_MULTIVARIATE_FUNCTION_ADAPTER_H
 
+#include <algorithm>            // std::sort, std::unique
 #include <cassert>
 #include <type_traits>          // std::is_same, std::is_convertible
 #include <variant>              // std::visit
@@ -61,13 +62,56 @@ class MultivariateFunctionAdapter: public Function {
   std::vector<typename Fn::domain_type> _variables;
   /// Converter from codomain to double
   Conv _converter;
+  /// Start of each variable in bit vectors
+  std::vector<int> _starts;
+  /// Variable index of each bit
+  std::vector<int> _bit_to_variable;
+  /// Bit vector from which the variables have been unpacked
+  bit_vector_t _unpacked_bv;
+  /// Indices of the variables to unpack
+  std::vector<int> _dirty_variables;
+  /// Memoize the unpacked variables
+  bool _memo = false;
+  /// Unpacked variables are valid
+  bool _unpacked_valid = false;
+  /// Unpack a single variable
+  void unpack(const bit_vector_t& bv, int i) {
+    _variables[i] = _representations[i].unpack(bv, _starts[i]);
+  }
   /// Unpack a bit vector into values
   void unpack(const bit_vector_t& bv) {
-    int start = 0;
-    for (size_t i = 0; i < _variables.size(); i++) {
-      _variables[i] = _representations[i].unpack(bv, start);
-      start += _representations[i].size();
+    for (size_t i = 0; i < _variables.size(); i++)
+      unpack(bv, i);
+  }
+  /// Unpack dirty variables
+  void unpack_dirty_variables() {
+    std::sort(_dirty_variables.begin(), _dirty_variables.end());
+    auto last = std::unique(_dirty_variables.begin(), _dirty_variables.end());
+    for (auto it = _dirty_variables.begin(); it != last; it++)
+      unpack(_unpacked_bv, *it);
+    _dirty_variables.clear();
+  }
+  /**
+   * Synchronize the unpacked variables with a bit vector.
+   *
+   * Only the variables which depend on bits differing from the last
+   * unpacked bit vector are unpacked again.
+   */
+  void synchronize(const bit_vector_t& bv) {
+    if (!_unpacked_valid) {
+      _unpacked_bv = bv;
+      unpack(bv);
+      _unpacked_valid = true;
+      return;
+    }
+    assert(_unpacked_bv.size() == bv.size());
+    for (size_t i = 0; i < bv.size(); i++) {
+      if (_unpacked_bv[i] != bv[i]) {
+        _unpacked_bv[i] = bv[i];
+        _dirty_variables.push_back(_bit_to_variable[i]);
+      }
     }
+    unpack_dirty_variables();
   }
 
 public:
@@ -88,7 +132,20 @@ public:
     , _variables(reps.size()) {
     assert(fn);
     assert(fn->get_num_variables() == int(reps.size()));
+    int start = 0;
+    for (size_t i = 0; i < _representations.size(); i++) {
+      _starts.push_back(start);
+      start += _representations[i].size();
+      _bit_to_variable.insert(_bit_to_variable.end(), _representations[i].size(), i);
+    }
   }
+  /**
+   * Set memo.
+   *
+   * If set, evaluate only unpacks the variables which have changed
+   * since the last evaluation.
+   */
+  void set_memo(bool b) { _memo = b; }
   /**
    * @name Information about the function
    */
@@ -100,6 +157,8 @@ public:
       result += rep.size();
     return result;
   }
+  /// Check whether the function provides incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
   ///@}
   /**
    * @name Evaluation
@@ -108,7 +167,29 @@ public:
   /// Evaluate
   double evaluate(const bit_vector_t& bv) override {
     assert(int(bv.size()) == get_bv_size());
-    unpack(bv);
+    if (_memo)
+      synchronize(bv);
+    else {
+      unpack(bv);
+      _unpacked_valid = false;
+    }
+    return _converter(_function->evaluate(_variables));
+  }
+  /**
+   * Incrementally evaluate a bit vector.
+   *
+   * Only the variables depending on flipped bits are unpacked
+   * again. The multivariate function itself is fully evaluated.
+   */
+  double evaluate_incrementally(const bit_vector_t& bv, double value, const sparse_bit_vector_t& flipped_bits) override {
+    assert(int(bv.size()) == get_bv_size());
+    synchronize(bv);
+    for (auto index : flipped_bits) {
+      assert(is_in_range(index, _unpacked_bv.size()));
+      bv_flip(_unpacked_bv, index);
+      _dirty_variables.push_back(_bit_to_variable[index]);
+    }
+    unpack_dirty_variables();
     return _converter(_function->evaluate(_variables));
   }
   ///@}
@@ -128,6 +209,7 @@ public:
   /// Describe a bit vector
   void describe(const bit_vector_t& bv, std::ostream& stream) override {
     unpack(bv);
+    _unpacked_valid = false;
     _function->describe(_variables, stream);
   }
   ///@}
@@ -162,14 +244,57 @@ class MixedRepresentationMultivariateFunctionAdapter: public Function {
   std::vector<typename Fn::domain_type> _variables;
   /// Converter from codomain to double
   Conv _converter;
+  /// Start of each variable in bit vectors
+  std::vector<int> _starts;
+  /// Variable index of each bit
+  std::vector<int> _bit_to_variable;
+  /// Bit vector from which the variables have been unpacked
+  bit_vector_t _unpacked_bv;
+  /// Indices of the variables to unpack
+  std::vector<int> _dirty_variables;
+  /// Memoize the unpacked variables
+  bool _memo = false;
+  /// Unpacked variables are valid
+  bool _unpacked_valid = false;
+  /// Unpack a single variable
+  void unpack(const bit_vector_t& bv, int i) {
+    int start = _starts[i];
+    _variables[i] = std::visit([&](auto&& arg) { return double(arg.unpack(bv, start)); }, _rep_variants[i]);
+  }
   /// Unpack a bit vector into values
   void unpack(const bit_vector_t& bv) {
-    int start = 0;
-    for (size_t i = 0; i < _variables.size(); i++) {
-      auto& v = _rep_variants[i];
-      _variables[i] = std::visit([&](auto&& arg) { return double(arg.unpack(bv, start)); }, v);
-      start += std::visit([](auto&& arg) { return arg.size(); }, v);
+    for (size_t i = 0; i < _variables.size(); i++)
+      unpack(bv, i);
+  }
+  /// Unpack dirty variables
+  void unpack_dirty_variables() {
+    std::sort(_dirty_variables.begin(), _dirty_variables.end());
+    auto last = std::unique(_dirty_variables.begin(), _dirty_variables.end());
+    for (auto it = _dirty_variables.begin(); it != last; it++)
+      unpack(_unpacked_bv, *it);
+    _dirty_variables.clear();
+  }
+  /**
+   * Synchronize the unpacked variables with a bit vector.
+   *
+   * Only the variables which depend on bits differing from the last
+   * unpacked bit vector are unpacked again.
+   */
+  void synchronize(const bit_vector_t& bv) {
+    if (!_unpacked_valid) {
+      _unpacked_bv = bv;
+      unpack(bv);
+      _unpacked_valid = true;
+      return;
+    }
+    assert(_unpacked_bv.size() == bv.size());
+    for (size_t i = 0; i < bv.size(); i++) {
+      if (_unpacked_bv[i] != bv[i]) {
+        _unpacked_bv[i] = bv[i];
+        _dirty_variables.push_back(_bit_to_variable[i]);
+      }
     }
+    unpack_dirty_variables();
   }
 
 public:
@@ -186,7 +311,21 @@ public:
     assert(fn);
     assert(fn->get_num_variables() == int(vs.size()));
     _variables.resize(vs.size());
+    int start = 0;
+    for (size_t i = 0; i < _rep_variants.size(); i++) {
+      int size = std::visit([](auto&& arg) { return arg.size(); }, _rep_variants[i]);
+      _starts.push_back(start);
+      start += size;
+      _bit_to_variable.insert(_bit_to_variable.end(), size, i);
+    }
   }
+  /**
+   * Set memo.
+   *
+   * If set, evaluate only unpacks the variables which have changed
+   * since the last evaluation.
+   */
+  void set_memo(bool b) { _memo = b; }
   /**
    * @name Information about the function
    */
@@ -198,6 +337,8 @@ public:
       result += std::visit([](auto&& arg) { return arg.size(); }, v);
     return result;
   }
+  /// Check whether the function provides incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
   ///@}
   /**
    * @name Evaluation
@@ -206,7 +347,29 @@ public:
   /// Evaluate
   double evaluate(const bit_vector_t& bv) override {
     assert(int(bv.size()) == get_bv_size());
-    unpack(bv);
+    if (_memo)
+      synchronize(bv);
+    else {
+      unpack(bv);
+      _unpacked_valid = false;
+    }
+    return _converter(_function->evaluate(_variables));
+  }
+  /**
+   * Incrementally evaluate a bit vector.
+   *
+   * Only the variables depending on flipped bits are unpacked
+   * again. The multivariate function itself is fully evaluated.
+   */
+  double evaluate_incrementally(const bit_vector_t& bv, double value, const sparse_bit_vector_t& flipped_bits) override {
+    assert(int(bv.size()) == get_bv_size());
+    synchronize(bv);
+    for (auto index : flipped_bits) {
+      assert(is_in_range(index, _unpacked_bv.size()));
+      bv_flip(_unpacked_bv, index);
+      _dirty_variables.push_back(_bit_to_variable[index]);
+    }
+    unpack_dirty_variables();
     return _converter(_function->evaluate(_variables));
   }
   ///@}
@@ -226,6 +389,7 @@ public:
   /// Describe a bit vector
   void describe(const bit_vector_t& bv, std::ostream& stream) override {
     unpack(bv);
+    _unpacked_valid = false;
     _function->describe(_variables, stream);
   }
   ///@}
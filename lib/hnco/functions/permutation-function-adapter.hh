@@ -23,6 +23,8 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::sort, std::unique
+
 #include "hnco/exception.hh"
 #include "hnco/representations/permutation.hh"
 
@@ -50,10 +52,50 @@ class PermutationFunctionAdapter: public Function {
   /// Permutation
   permutation_t _permutation;
 
+  /// Bit vector from which the permutation has been unpacked
+  bit_vector_t _unpacked_bv;
+
+  /// Elements the keys of which have changed
+  std::vector<int> _dirty_elements;
+
+  /// Unpacked permutation is valid
+  bool _unpacked_valid = false;
+
   /// Unpack a bit vector into a permutation
   void unpack(const bit_vector_t& bv) {
     assert(int(bv.size()) == _representation.size());
     _representation.unpack(bv, 0, _permutation);
+    _unpacked_valid = false;
+  }
+
+  /// Update the permutation with the dirty elements
+  void update_dirty_elements() {
+    std::sort(_dirty_elements.begin(), _dirty_elements.end());
+    _dirty_elements.erase(std::unique(_dirty_elements.begin(), _dirty_elements.end()), _dirty_elements.end());
+    _representation.update(_unpacked_bv, 0, _permutation, _dirty_elements);
+    _dirty_elements.clear();
+  }
+
+  /** Synchronize the unpacked permutation with a bit vector.
+
+      Only the elements the keys of which depend on bits differing
+      from the last unpacked bit vector are moved.
+  */
+  void synchronize(const bit_vector_t& bv) {
+    assert(int(bv.size()) == _representation.size());
+    if (!_unpacked_valid) {
+      _unpacked_bv = bv;
+      _representation.unpack(bv, 0, _permutation);
+      _unpacked_valid = true;
+      return;
+    }
+    for (size_t i = 0; i < bv.size(); i++) {
+      if (_unpacked_bv[i] != bv[i]) {
+        _unpacked_bv[i] = bv[i];
+        _dirty_elements.push_back(_representation.get_element(0, i));
+      }
+    }
+    update_dirty_elements();
   }
 
 public:
@@ -77,12 +119,32 @@ public:
   /// Get bit vector size
   int get_bv_size() const override { return _representation.size(); }
 
+  /// Check whether the function provides incremental evaluation
+  bool provides_incremental_evaluation() const override { return true; }
+
   /// Evaluate
   double evaluate(const bit_vector_t& bv) override {
     unpack(bv);
     return _function->evaluate(_permutation);
   }
 
+  /** Incrementally evaluate a bit vector.
+
+      Only the elements depending on flipped bits are moved in the
+      permutation. The permutation function itself is fully
+      evaluated.
+  */
+  double evaluate_incrementally(const bit_vector_t& bv, double value, const sparse_bit_vector_t& flipped_bits) override {
+    synchronize(bv);
+    for (auto index : flipped_bits) {
+      assert(is_in_range(index, _unpacked_bv.size()));
+      bv_flip(_unpacked_bv, index);
+      _dirty_elements.push_back(_representation.get_element(0, index));
+    }
+    update_dirty_elements();
+    return _function->evaluate(_permutation);
+  }
+
   /// Display
   void display(std::ostream& stream) const override {
     _function->display(stream);
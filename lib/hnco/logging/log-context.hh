@@ -21,10 +21,12 @@
 #ifndef HNCO_LOGGING_LOG_CONTEXT_H
 #define HNCO_LOGGING_LOG_CONTEXT_H
 
-#include <sstream>              // std::ostringstream
+#include <string>
 
 #include "hnco/functions/controllers/controller.hh"
 
+#include "log-sink.hh"
+
 namespace hnco {
 namespace logging {
 
@@ -39,6 +41,15 @@ class LogContext {
 public:
   /// Convert context to string
   virtual std::string to_string() = 0;
+
+  /**
+   * Append context to a line.
+   *
+   * The default implementation appends to_string(). Derived classes
+   * should override it to avoid building a temporary string for
+   * each line.
+   */
+  virtual void append_to(std::string& line) { line += to_string(); }
 };
 
 /// Log context for ProgressTracker
@@ -59,12 +70,19 @@ public:
    * - Value of the best so far solution
    */
   std::string to_string() {
+    std::string line;
+    append_to(line);
+    return line;
+  }
+  /// Append context to a line
+  void append_to(std::string& line) {
     assert(_progress_tracker);
-    std::ostringstream stream;
-    stream
-      << _progress_tracker->get_num_calls() << " "
-      << _progress_tracker->get_last_improvement();
-    return stream.str();
+    const auto& last_improvement = _progress_tracker->get_last_improvement();
+    append_value(line, _progress_tracker->get_num_calls());
+    line += ' ';
+    append_value(line, last_improvement.num_evaluations);
+    line += ' ';
+    append_value(line, last_improvement.solution.second);
   }
 };
 
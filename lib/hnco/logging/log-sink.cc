@@ -0,0 +1,115 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <chrono>
+#include <iostream>             // std::cout
+
+#include "log-sink.hh"
+
+using namespace hnco::logging;
+
+
+LogSink::LogSink():
+  _stream(&std::cout)
+{
+  _pending.reserve(_capacity);
+  _writing.reserve(_capacity);
+  _writer = std::thread(&LogSink::write_loop, this);
+}
+
+LogSink::~LogSink()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _quit = true;
+  }
+  _work.notify_one();
+  _writer.join();
+}
+
+LogSink&
+LogSink::get()
+{
+  static LogSink sink;
+  return sink;
+}
+
+void
+LogSink::write_loop()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  for (;;) {
+    // Nothing to write, no timeout
+    _work.wait(lock, [this] {
+      return _quit || _num_flush_requests > _num_flushes || !_pending.empty();
+    });
+    // Let lines accumulate
+    _work.wait_for(lock, std::chrono::milliseconds(100), [this] {
+      return _quit || _num_flush_requests > _num_flushes || _pending.size() >= _capacity;
+    });
+    const long num_flush_requests = _num_flush_requests;
+    const bool quit = _quit;
+    if (!_pending.empty()) {
+      std::ostream *stream = _stream;
+      _writing.swap(_pending);
+      lock.unlock();
+      stream->write(_writing.data(), _writing.size());
+      stream->flush();
+      _writing.clear();
+      lock.lock();
+    }
+    _num_flushes = num_flush_requests;
+    _done.notify_all();
+    if (quit)
+      break;
+  }
+}
+
+void
+LogSink::write(const std::string& line)
+{
+  bool notify;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    notify = _pending.empty();
+    _pending += line;
+    _pending += '\n';
+    notify = notify || _pending.size() >= _capacity;
+  }
+  if (notify)
+    _work.notify_one();
+}
+
+void
+LogSink::flush()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  const long request = ++_num_flush_requests;
+  _work.notify_one();
+  _done.wait(lock, [this, request] { return _num_flushes >= request; });
+}
+
+void
+LogSink::set_stream(std::ostream& stream)
+{
+  flush();
+  std::lock_guard<std::mutex> lock(_mutex);
+  _stream = &stream;
+}
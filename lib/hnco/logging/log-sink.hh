@@ -0,0 +1,176 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef HNCO_LOGGING_LOG_SINK_H
+#define HNCO_LOGGING_LOG_SINK_H
+
+#include <charconv>             // std::to_chars
+#include <condition_variable>
+#include <cstddef>              // std::size_t
+#include <mutex>
+#include <ostream>
+#include <sstream>              // std::ostringstream
+#include <string>
+#include <thread>
+#include <type_traits>          // std::is_arithmetic_v
+
+namespace hnco {
+namespace logging {
+
+/**
+ * Append a value to a line.
+ *
+ * Arithmetic values are formatted with std::to_chars, without going
+ * through a stream. Floating point values are formatted as with the
+ * default precision of a stream, that is as printf with "%g".
+ *
+ * @param line Line
+ * @param value Value
+ */
+template<class T>
+void append_value(std::string& line, const T& value)
+{
+  if constexpr (std::is_same_v<T, bool>) {
+    line += value ? '1' : '0';
+  } else if constexpr (std::is_same_v<T, char>) {
+    line += value;
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    char buffer[64];
+    std::to_chars_result result;
+    if constexpr (std::is_floating_point_v<T>)
+      result = std::to_chars(buffer, buffer + sizeof buffer, value, std::chars_format::general, 6);
+    else
+      result = std::to_chars(buffer, buffer + sizeof buffer, value);
+    line.append(buffer, result.ptr);
+  } else if constexpr (std::is_convertible_v<const T&, const char *>) {
+    line += static_cast<const char *>(value);
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    line += value;
+  } else {
+    std::ostringstream stream;
+    stream << value;
+    line += stream.str();
+  }
+}
+
+/**
+ * Log sink.
+ *
+ * A log sink collects lines from any thread into a buffer and writes
+ * them to a stream from a background thread. Producers only hold a
+ * mutex while appending a line to the buffer; the writer swaps the
+ * buffer for an empty one and writes it without holding the mutex.
+ * The writer sleeps until a line arrives, then writes the buffer when
+ * it is large enough, when a flush is requested, or after a short
+ * delay so that lines do not stay in the buffer for too long.
+ *
+ * There is a single sink, which writes to std::cout by default. It
+ * is flushed when it is destroyed at program exit. Lines may still be
+ * pending when an algorithm returns, hence code writing directly to
+ * the stream of the sink after logging, for example results printed
+ * to std::cout, must call flush first.
+ */
+class LogSink {
+
+  /// Stream
+  std::ostream *_stream;
+
+  /// Lines waiting to be written
+  std::string _pending;
+
+  /// Lines being written
+  std::string _writing;
+
+  /// Mutex
+  std::mutex _mutex;
+
+  /// Condition variable signaled when there is work for the writer
+  std::condition_variable _work;
+
+  /// Condition variable signaled when the writer is done with a buffer
+  std::condition_variable _done;
+
+  /// Writer thread
+  std::thread _writer;
+
+  /// Number of flush requests
+  long _num_flush_requests = 0;
+
+  /// Number of flush requests served by the writer
+  long _num_flushes = 0;
+
+  /// Quit
+  bool _quit = false;
+
+  /// Size of the buffer above which the writer is woken up
+  std::size_t _capacity = 1 << 16;
+
+  /// Constructor
+  LogSink();
+
+  /// Writer loop
+  void write_loop();
+
+public:
+
+  /// Destructor
+  ~LogSink();
+
+  LogSink(const LogSink&) = delete;
+  LogSink& operator=(const LogSink&) = delete;
+
+  /// Get the sink
+  static LogSink& get();
+
+  /**
+   * Write a line.
+   *
+   * A newline is appended to the line. The line is written later by
+   * the writer thread, which is woken up by the first line of an
+   * empty buffer.
+   *
+   * @param line Line without trailing newline
+   */
+  void write(const std::string& line);
+
+  /**
+   * Flush.
+   *
+   * Blocks until all lines written so far have been written to the
+   * stream and the stream has been flushed.
+   */
+  void flush();
+
+  /**
+   * Set the stream.
+   *
+   * The sink is flushed before the stream is changed. It should not
+   * be called while other threads are logging.
+   *
+   * @param stream Stream
+   */
+  void set_stream(std::ostream& stream);
+
+};
+
+} // end of namespace logging
+} // end of namespace hnco
+
+#endif
@@ -21,11 +21,10 @@
 #ifndef HNCO_LOGGING_LOGGER_H
 #define HNCO_LOGGING_LOGGER_H
 
-#include <iostream>             // std::cout
-#include <sstream>              // std::ostringstream
 #include <string>
 
 #include "log-context.hh"
+#include "log-sink.hh"
 
 namespace hnco {
 /// Logging
@@ -37,10 +36,14 @@ namespace logging {
  * Simple logger inspired by the Log class published in Dr. Dobb's:
  *
  * https://www.drdobbs.com/cpp/logging-in-c/201804215
+ *
+ * Values are formatted without going through a stream and the line
+ * is handed over to the LogSink which writes it asynchronously. A
+ * logger can be used from any thread.
  */
 class Logger {
   /// Line
-  std::ostringstream _line;
+  std::string _line;
 public:
   /// Default constructor
   Logger() {}
@@ -49,18 +52,21 @@ public:
    * @param context Log context
    */
   Logger(LogContext *context) {
-    if (context)
-      _line << context->to_string() << " ";
+    if (context) {
+      context->append_to(_line);
+      _line += ' ';
+    }
   }
   /**
    * Destructor.
-   * Sends _line to std::cout and flushes it.
+   * Sends _line to the log sink.
    */
-  virtual ~Logger() { std::cout << _line.str() << std::endl; }
+  virtual ~Logger() { LogSink::get().write(_line); }
   /// Append data to the line
   template<class T>
   Logger& operator<<(T value) {
-    _line << value << " ";
+    append_value(_line, value);
+    _line += ' ';
     return *this;
   }
 };
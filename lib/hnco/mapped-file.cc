@@ -0,0 +1,89 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap, munmap
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // close, ftruncate
+
+#include <stdexcept>            // std::runtime_error
+
+#include "mapped-file.hh"
+
+
+using namespace hnco;
+
+
+MappedFile::MappedFile(std::string path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("MappedFile::MappedFile: Cannot open " + path);
+
+  struct stat status;
+  if (fstat(fd, &status) < 0) {
+    close(fd);
+    throw std::runtime_error("MappedFile::MappedFile: Cannot stat " + path);
+  }
+  _size = status.st_size;
+
+  if (_size > 0) {
+    void *address = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("MappedFile::MappedFile: Cannot map " + path);
+    }
+    _data = static_cast<char *>(address);
+  }
+
+  // The mapping remains valid after the file descriptor is closed
+  close(fd);
+}
+
+MappedFile::MappedFile(std::string path, std::size_t size)
+  : _size(size)
+  , _writable(true)
+{
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    throw std::runtime_error("MappedFile::MappedFile: Cannot create " + path);
+
+  if (ftruncate(fd, _size) < 0) {
+    close(fd);
+    throw std::runtime_error("MappedFile::MappedFile: Cannot resize " + path);
+  }
+
+  if (_size > 0) {
+    void *address = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("MappedFile::MappedFile: Cannot map " + path);
+    }
+    _data = static_cast<char *>(address);
+  }
+
+  close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+  if (_data)
+    munmap(_data, _size);
+}
@@ -0,0 +1,93 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef HNCO_MAPPED_FILE_H
+#define HNCO_MAPPED_FILE_H
+
+#include <assert.h>
+
+#include <cstddef>              // std::size_t
+#include <string>               // std::string
+
+
+namespace hnco {
+
+
+/** Memory-mapped file.
+
+    A file is either mapped read-only or created with a given size
+    and mapped read-write. In the latter case, changes are written
+    back to the file by the kernel, which allows arrays larger than
+    the physical memory.
+*/
+class MappedFile {
+
+  /// Data
+  char *_data = nullptr;
+
+  /// Size
+  std::size_t _size = 0;
+
+  /// Writable mapping
+  bool _writable = false;
+
+public:
+
+  /** Map an existing file read-only.
+      \param path Path of the file
+      \throw std::runtime_error
+  */
+  MappedFile(std::string path);
+
+  /** Create a file and map it read-write.
+
+      An existing file is truncated.
+
+      \param path Path of the file
+      \param size Size in bytes
+      \throw std::runtime_error
+  */
+  MappedFile(std::string path, std::size_t size);
+
+  /// Destructor
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Get data
+  const char *data() const { return _data; }
+
+  /// Get writable data
+  char *writable_data() {
+    assert(_writable);
+    return _data;
+  }
+
+  /// Get size
+  std::size_t size() const { return _size; }
+
+};
+
+
+} // end of namespace hnco
+
+
+#endif
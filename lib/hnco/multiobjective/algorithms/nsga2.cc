@@ -40,6 +40,9 @@ Nsga2::init()
   _mutation.set_mutation_rate(_mutation_rate);
   _mutation.set_allow_no_mutation(_allow_no_mutation);
 
+  if (_functions.size() > 1)
+    _parallel_reproduction.init(_functions.size(), _selection_by_front_distance_pair, _mutation, _crossover);
+
   _parents.random();
   _parents.evaluate(_function);
 
@@ -68,7 +71,10 @@ Nsga2::iterate()
   const int population_size = _parents.get_size();
   const int num_objectives = _function->get_output_size();
 
-  _offsprings.evaluate(_function);
+  if (_functions.size() > 1)
+    _offsprings.evaluate_in_parallel(_functions);
+  else
+    _offsprings.evaluate(_function);
 
   // Build full population (parents + offsprings)
   for (int i = 0; i < population_size; i++) {
@@ -131,6 +137,16 @@ Nsga2::iterate()
   }
 
   // Offsprings
+  if (_functions.size() > 1)
+    _parallel_reproduction.generate(_offsprings.bvs, _do_crossover.p());
+  else
+    generate_offsprings();
+
+}
+
+void
+Nsga2::generate_offsprings()
+{
   _selection_by_front_distance_pair.init();
   for (int i = 0; i < _offsprings.get_size(); i++) {
     bit_vector_t& offspring = _offsprings.bvs[i];
@@ -140,7 +156,6 @@ Nsga2::iterate()
       offspring = _selection_by_front_distance_pair.select();
     _mutation.mutate(offspring);
   }
-
 }
 
 void
@@ -24,6 +24,7 @@
 #include <functional>           // std::less
 
 #include "hnco/algorithms/evolutionary-algorithms/crossover.hh"    // hnco::algorithm::UniformCrossover
+#include "hnco/algorithms/evolutionary-algorithms/parallel-reproduction.hh" // hnco::algorithm::ParallelReproduction
 #include "hnco/neighborhoods/neighborhood.hh" // hnco::neighborhood::StandardBitMutation
 
 #include "iterative-algorithm.hh"
@@ -75,6 +76,10 @@ inline bool operator<(const FrontDistancePair& a, const FrontDistancePair& b)
  * 
  * https://link.springer.com/chapter/10.1007/3-540-45356-3_83
  * 
+ * If several functions are given to minimize, offsprings are
+ * generated and evaluated in parallel (see
+ * hnco::algorithm::ParallelReproduction). Results only depend on the
+ * seed and the number of threads.
  */
 class Nsga2: public IterativeAlgorithm {
 protected:
@@ -105,6 +110,9 @@ protected:
   /// Selection by front distance pairs
   TournamentSelection<FrontDistancePair, std::less<FrontDistancePair>> _selection_by_front_distance_pair;
 
+  /// Parallel reproduction
+  hnco::algorithm::ParallelReproduction<TournamentSelection<FrontDistancePair, std::less<FrontDistancePair>>> _parallel_reproduction;
+
   /**
    * @name Parameters
    */
@@ -133,6 +141,9 @@ protected:
   void log() override {}
   ///@}
 
+  /// Generate offsprings
+  void generate_offsprings();
+
 public:
   /**
    * Constructor.
@@ -48,7 +48,8 @@ void Population::evaluate_in_parallel(const std::vector<Function *>& functions)
   assert(have_same_size(bvs, values));
   assert(!functions.empty());
 
-#pragma omp parallel for
+  const int num_threads = functions.size();
+#pragma omp parallel for num_threads(num_threads)
   for (size_t i = 0; i < bvs.size(); i++) {
     const int k = omp_get_thread_num();
     assert(is_in_range(k, functions.size()));
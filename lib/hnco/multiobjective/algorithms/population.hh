@@ -117,7 +117,8 @@ struct Population {
   void evaluate(Function *function);
 
   /**
-   * Evaluate a population in parallel.
+   * Evaluate a population in parallel. One thread is used per
+   * function.
    */
   void evaluate_in_parallel(const std::vector<Function *>& functions);
 
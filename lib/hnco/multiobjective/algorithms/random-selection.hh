@@ -21,8 +21,11 @@
 #ifndef HNCO_MULTIOBJECTIVE_ALGORITHMS_RANDOM_SELECTION_H
 #define HNCO_MULTIOBJECTIVE_ALGORITHMS_RANDOM_SELECTION_H
 
+#include <algorithm>            // std::shuffle
+
 #include "hnco/bit-vector.hh"
 #include "hnco/permutation.hh"
+#include "hnco/random.hh"
 
 
 namespace hnco {
@@ -62,6 +65,9 @@ class TournamentSelection {
   /// Comparison operator
   Compare _compare;
 
+  /// Random engine
+  std::mt19937 *_engine = &random::Generator::engine;
+
   /** @name Parameters
    */
   ///@{
@@ -86,7 +92,7 @@ public:
 
   /// Initialize
   void init() {
-    perm_shuffle(_permutation);
+    std::shuffle(_permutation.begin(), _permutation.end(), *_engine);
     _start = 0;
     _stop = _tournament_size;
   }
@@ -124,6 +130,9 @@ public:
     _tournament_size = n;
   }
 
+  /// Set the random engine
+  void set_engine(std::mt19937 *engine) { _engine = engine; }
+
   ///@}
 
 };
@@ -26,6 +26,7 @@
 #include <fstream>              // std::ifstream, std::ofstream
 #include <iostream>
 
+#include "hnco/logging/log-sink.hh"
 #include "hnco/multiobjective/algorithms/algorithm.hh"
 #include "hnco/multiobjective/algorithms/pareto-front-computation.hh"
 #include "hnco/random.hh"
@@ -123,6 +124,9 @@ CommandLineApplication::minimize()
 
   stop_watch.stop();
 
+  // Log lines must precede results
+  logging::LogSink::get().flush();
+
 }
 
 void
@@ -20,7 +20,9 @@
 
 #include <assert.h>
 
-#include <algorithm>            // std::find
+#include <math.h>               // std::floor, std::log1p, std::expm1
+
+#include <algorithm>            // std::min, std::sort
 
 #include "neighborhood.hh"
 
@@ -31,34 +33,22 @@ using namespace hnco;
 
 
 void
-MultiBitFlip::bernoulli_trials(int k)
+MultiBitFlip::sample_distinct_bits(int k)
 {
-  int n = _candidate.size();
-
-  _flipped_bits.clear();
-  for (size_t i = 0; i < _candidate.size(); i++) {
-    double p = double(k) / double(n);
-    if (Generator::uniform() < p) {
-      _flipped_bits.push_back(i);
-      k--;
-    }
-    n--;
-  }
-  assert(k == 0);
-}
-
+  const int n = _candidate.size();
+  assert(0 <= k && k <= n);
 
-void
-MultiBitFlip::rejection_sampling(int k)
-{
   _flipped_bits.clear();
-  for (int i = 0; i < k; i++) {
-    int index;
-    do {
-      index = _index_dist(Generator::engine);
-    } while (std::find(begin(_flipped_bits), end(_flipped_bits), index) != _flipped_bits.end());
+  for (int j = n - k; j < n; j++) {
+    int index = std::uniform_int_distribution<int>(0, j)(Generator::engine);
+    if (_marks[index])
+      index = j;
+    assert(!_marks[index]);
+    _marks[index] = 1;
     _flipped_bits.push_back(index);
   }
+  for (auto index: _flipped_bits)
+    _marks[index] = 0;
   std::sort(begin(_flipped_bits), end(_flipped_bits));
 }
 
@@ -66,57 +56,41 @@ MultiBitFlip::rejection_sampling(int k)
 void
 StandardBitMutation::sample_bits()
 {
-  if (_rejection_sampling) {
-    int k;
-    if (_allow_no_mutation)
-      k = _binomial_dist(Generator::engine);
-    else {
-      k = 0;
-      while (k == 0)
-        k = _binomial_dist(Generator::engine);
-      assert(k > 0);
-    }
-    rejection_sampling(k);
-  } else
-    bernoulli_process();
-}
-
+  const double n = _candidate.size();
+
+  // First flipped bit
+  double index;
+  if (_allow_no_mutation)
+    index = Generator::geometric(_log_q, *_engine);
+  else {
+    // Inversion of the distribution conditioned on index < n
+    double u = std::uniform_real_distribution<double>()(*_engine);
+    index = std::floor(std::log1p(u * std::expm1(n * _log_q)) / _log_q);
+    index = std::min(index, n - 1);
+  }
 
-void
-StandardBitMutation::bernoulli_process()
-{
   _flipped_bits.clear();
-  bool again = true;
-  do {
-    for (size_t i = 0; i < _candidate.size(); i++)
-      if (_bernoulli_dist(Generator::engine)) {
-        _flipped_bits.push_back(i);
-        again = false;
-      }
-  } while (again);
+  while (index < n) {
+    _flipped_bits.push_back(index);
+    index += 1 + Generator::geometric(_log_q, *_engine);
+  }
+  assert(_allow_no_mutation || !_flipped_bits.empty());
 }
 
 
 void
 HammingBall::sample_bits()
 {
-  const int n = _candidate.size();
   const int k = _choose_k(Generator::engine);
   assert(k > 0);
-  assert(k <= n);
+  assert(k <= int(_candidate.size()));
 
-  if (k < std::sqrt(n))
-    rejection_sampling(k);
-  else
-    bernoulli_trials(k);
+  sample_distinct_bits(k);
 }
 
 
 void
 HammingSphere::sample_bits()
 {
-  if (_radius < std::sqrt(_candidate.size()))
-    rejection_sampling(_radius);
-  else
-    bernoulli_trials(_radius);
+  sample_distinct_bits(_radius);
 }
@@ -22,6 +22,7 @@
 #define HNCO_NEIGHBORHOODS_NEIGHBORHOOD_H
 
 #include <assert.h>
+#include <math.h>               // std::log1p
 
 #include "hnco/bit-vector.hh"
 #include "hnco/iterator.hh"
@@ -109,6 +110,13 @@ public:
   /// Get flipped bits
   virtual const sparse_bit_vector_t& get_flipped_bits() const { return _flipped_bits; }
 
+  /** Sample flipped bits.
+
+      No bit vector is modified. The sampled bits are available
+      through get_flipped_bits.
+  */
+  virtual void sample_flipped_bits() { sample_bits(); }
+
   /// Propose a candidate bit vector
   virtual void propose() {
     assert(_candidate == _origin);
@@ -185,19 +193,21 @@ public:
 class MultiBitFlip:
     public Neighborhood {
 
+  /// Marks of sampled bits
+  bit_vector_t _marks;
+
 protected:
 
-  /** Sample a given number of bits using Bernoulli trials.
+  /** Sample a given number of distinct bits.
 
-      \param k Number of bits to sample
-  */
-  void bernoulli_trials(int k);
-
-  /** Sample a given number of bits using rejection sampling.
+      Uses Floyd's algorithm, which draws exactly k random numbers.
+      Sampled bits are marked in a bit vector which is cleared
+      afterwards, hence the cost is O(k log k), including sorting,
+      whatever the size of bit vectors.
 
       \param k Number of bits to sample
   */
-  void rejection_sampling(int k);
+  void sample_distinct_bits(int k);
 
 public:
 
@@ -206,7 +216,8 @@ public:
       \param n Size of bit vectors
   */
   MultiBitFlip(int n):
-    Neighborhood(n) {}
+    Neighborhood(n),
+    _marks(n, 0) {}
 
 };
 
@@ -218,18 +229,21 @@ public:
     flipped at the end, the process is started all over again. Thus
     the number of flipped bits follows a pseudo binomial law.
 
+    The Bernoulli process is sampled by geometric skips from one
+    flipped bit to the next, hence the cost is proportional to the
+    number of flipped bits. Instead of starting the process all over
+    again, the first flipped bit is directly sampled conditionally on
+    at least one bit being flipped.
+
 */
 class StandardBitMutation:
     public MultiBitFlip {
 
-  /// Bernoulli distribution (biased coin)
-  std::bernoulli_distribution _bernoulli_dist;
-
-  /// Binomial distribution
-  std::binomial_distribution<int> _binomial_dist;
+  /// Logarithm of the probability of not flipping a bit
+  double _log_q;
 
-  /// Rejection sampling
-  bool _rejection_sampling = false;
+  /// Random engine
+  std::mt19937 *_engine = &random::Generator::engine;
 
   /** @name Parameters
    */
@@ -243,9 +257,6 @@ class StandardBitMutation:
   /// Sample bits
   void sample_bits();
 
-  /// Bernoulli process
-  void bernoulli_process();
-
 public:
 
   /** Constructor.
@@ -255,9 +266,7 @@ public:
       The Bernoulli probability is set to 1 / n.
   */
   StandardBitMutation(int n):
-    MultiBitFlip(n),
-    _bernoulli_dist(1 / double(n)),
-    _binomial_dist(n, 1 / double(n)) {}
+    StandardBitMutation(n, 1 / double(n)) {}
 
   /** Constructor.
 
@@ -265,9 +274,10 @@ public:
       \param p Bernoulli probability
   */
   StandardBitMutation(int n, double p):
-    MultiBitFlip(n),
-    _bernoulli_dist(p),
-    _binomial_dist(n, p) {}
+    MultiBitFlip(n)
+  {
+    set_mutation_rate(p);
+  }
 
   /** @name Setters
    */
@@ -275,20 +285,26 @@ public:
 
   /** Set mutation rate.
 
-      Sets _rejection_sampling to true if E(X) < sqrt(n), where X is
-      a random variable with a binomial distribution B(n, p), that
-      is if np < sqrt(n) or p < 1 / sqrt(n).
+      \param p Bernoulli probability
+      \pre 0 < p <= 1
   */
   void set_mutation_rate(double p) {
-    _bernoulli_dist = std::bernoulli_distribution(p);
-    _binomial_dist = std::binomial_distribution<int>(_origin.size(), p);
-    if (p < 1 / std::sqrt(_origin.size()))
-      _rejection_sampling = true;
+    assert(p > 0);
+    assert(p <= 1);
+    _log_q = std::log1p(-p);
   }
 
   /// Set the flag _allow_no_mutation
   void set_allow_no_mutation(bool b) { _allow_no_mutation = b; }
 
+  /** Set the random engine.
+
+      By default, random::Generator::engine is used. A thread-local
+      copy of the mutation operator should draw from a thread-local
+      engine.
+  */
+  void set_engine(std::mt19937 *engine) { _engine = engine; }
+
   ///@}
 
 };
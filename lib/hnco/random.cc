@@ -18,6 +18,8 @@
 
 */
 
+#include <math.h>               // std::floor, std::log1p
+
 #include <chrono>               // std::chrono::system_clock
 
 #include "random.hh"
@@ -64,3 +66,14 @@ bool Generator::bernoulli()
   std::bernoulli_distribution dist;
   return dist(engine);
 }
+
+double Generator::geometric(double log_q)
+{
+  return geometric(log_q, engine);
+}
+
+double Generator::geometric(double log_q, std::mt19937& engine)
+{
+  std::uniform_real_distribution<double> dist;
+  return std::floor(std::log1p(-dist(engine)) / log_q);
+}
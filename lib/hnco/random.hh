@@ -21,7 +21,11 @@
 #ifndef HNCO_RANDOM_H
 #define HNCO_RANDOM_H
 
-#include <random>               // std::mt19937
+#include <assert.h>
+
+#include <cstddef>              // std::size_t
+#include <random>               // std::mt19937, std::seed_seq
+#include <vector>
 
 
 namespace hnco {
@@ -63,6 +67,115 @@ struct Generator {
   /// Sample random number with Bernoulli distribution
   static bool bernoulli();
 
+  /** Sample random number with geometric distribution.
+
+      The result is the number of failures before the first success
+      in a Bernoulli process. It is sampled by inversion with a
+      single uniform random number.
+
+      \param log_q Logarithm of the probability of failure, that is log(1 - p)
+      \return A nonnegative integer stored in a double
+  */
+  static double geometric(double log_q);
+
+  /** Sample random number with geometric distribution.
+
+      \param log_q Logarithm of the probability of failure, that is log(1 - p)
+      \param engine Engine to draw from
+      \return A nonnegative integer stored in a double
+  */
+  static double geometric(double log_q, std::mt19937& engine);
+
+};
+
+
+/** Deterministic stream of random numbers generated in parallel.
+
+    The stream is divided into chunks of fixed size. Each chunk is
+    generated by its own engine seeded with the seed of the stream
+    and the index of the chunk, hence the stream only depends on the
+    seed and the chunk size, not on the number of threads. Chunks are
+    generated by batches, in parallel, and consumed sequentially so
+    that only one batch is kept in memory.
+
+    \tparam Distribution Type of distribution
+*/
+template<class Distribution>
+class ChunkedStream {
+
+public:
+
+  /// Type of values
+  using value_type = typename Distribution::result_type;
+
+private:
+
+  /// Distribution
+  Distribution _distribution;
+
+  /// Seed
+  unsigned _seed;
+
+  /// Chunk size
+  std::size_t _chunk_size;
+
+  /// Number of chunks per batch
+  std::size_t _batch_size;
+
+  /// Values of the current batch
+  std::vector<value_type> _values;
+
+  /// Position in the current batch
+  std::size_t _position = 0;
+
+  /// Index of the first chunk of the next batch
+  std::size_t _next_chunk = 0;
+
+  /// Generate the next batch
+  void generate_batch() {
+    _values.resize(_chunk_size * _batch_size);
+
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < _batch_size; i++) {
+      const std::size_t chunk = _next_chunk + i;
+      std::seed_seq seq{_seed, unsigned(chunk), unsigned(chunk >> 32)};
+      std::mt19937 engine(seq);
+      Distribution distribution(_distribution);
+      value_type *values = _values.data() + i * _chunk_size;
+      for (std::size_t j = 0; j < _chunk_size; j++)
+        values[j] = distribution(engine);
+    }
+
+    _next_chunk += _batch_size;
+    _position = 0;
+  }
+
+public:
+
+  /** Constructor.
+
+      \param distribution Distribution
+      \param seed Seed
+      \param chunk_size Chunk size
+      \param batch_size Number of chunks per batch
+  */
+  ChunkedStream(Distribution distribution, unsigned seed, std::size_t chunk_size, std::size_t batch_size):
+    _distribution(distribution),
+    _seed(seed),
+    _chunk_size(chunk_size),
+    _batch_size(batch_size)
+  {
+    assert(chunk_size > 0);
+    assert(batch_size > 0);
+  }
+
+  /// Next value
+  value_type operator()() {
+    if (_position == _values.size())
+      generate_batch();
+    return _values[_position++];
+  }
+
 };
 
 
@@ -23,9 +23,10 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::min
 #include <vector>
 #include <iostream>             // std::ostream
-#include <cmath>                // std::log, std::ceil
+#include <cmath>                // std::log, std::ceil, std::ldexp
 #include <complex>              // std::complex
 #include <bitset>               // std::bitset
 
@@ -43,8 +44,17 @@ namespace representation {
 template<class T>
 class DyadicFloatRepresentation {
 
-  /// Lengths of dyadic intervals
-  std::vector<T> _lengths;
+  /// Size in bits
+  int _size;
+
+  /**
+   * Scales of 64-bit blocks.
+   *
+   * The bits are unpacked by blocks of at most 64 bits. A block is
+   * converted into an unsigned integer which is then multiplied by
+   * the scale of the block.
+   */
+  std::vector<T> _scales;
 
   /// Lower bound of the interval
   T _lower_bound;
@@ -52,23 +62,26 @@ class DyadicFloatRepresentation {
   /// Length of the interval
   T _length;
 
+  /// Size in bits of a block
+  static constexpr int block_size = 64;
+
   /// Affine transformation
   T affine_transformation(T x) { return _lower_bound + _length * x; }
 
   /**
-   * Compute lengths.
+   * Compute scales.
    *
    * @param size Size in bits per float number
    */
-  void compute_lengths(int size)
+  void compute_scales(int size)
   {
     assert(size > 0);
 
-    _lengths = std::vector<T>(size);
-    T x = 0.5;
-    for (size_t i = 0; i < _lengths.size(); i++) {
-      _lengths[i] = x;
-      x /= 2;
+    _size = size;
+    _scales.clear();
+    for (int start = 0; start < size; start += block_size) {
+      int stop = std::min(start + block_size, size);
+      _scales.push_back(std::ldexp(T(1), -stop));
     }
   }
 
@@ -93,7 +106,7 @@ public:
     assert(lower_bound < upper_bound);
     assert(size > 0);
 
-    compute_lengths(size);
+    compute_scales(size);
   }
 
   /**
@@ -113,13 +126,18 @@ public:
     assert(precision > 0);
 
     int size = std::ceil(std::log(_length / precision) / std::log(2));
-    compute_lengths(size);
+    compute_scales(size);
   }
 
   /// Size of the representation
-  int size() const { return _lengths.size(); }
+  int size() const { return _size; }
 
-  /// Unpack bit vector into a value
+  /**
+   * Unpack bit vector into a value.
+   *
+   * The first bit is the most significant one. Bits are extracted by
+   * blocks of 64 bits with bv_to_size_type_msb_first.
+   */
   domain_type unpack(const bit_vector_t& bv, int start) {
     assert(hnco::is_in_range(start, bv.size()));
 
@@ -127,12 +145,13 @@ public:
     assert(hnco::is_in_range(stop, start + 1, bv.size() + 1));
 
     T result = 0;
-    for (int i = start, offset = 0; i < stop; i++, offset++) {
-      assert(hnco::is_in_range(i, bv.size()));
-      assert(hnco::is_in_range(offset, _lengths.size()));
-      if (bv[i])
-        result += _lengths[offset];
+    int i = start;
+    for (const auto scale : _scales) {
+      int block_stop = std::min(i + block_size, stop);
+      result += T(bv_to_size_type_msb_first(bv, i, block_stop)) * scale;
+      i = block_stop;
     }
+    assert(i == stop);
     return affine_transformation(result);
   }
 
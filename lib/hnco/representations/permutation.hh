@@ -23,10 +23,13 @@
 
 #include <assert.h>
 
+#include <algorithm>            // std::fill, std::find
 #include <vector>
 #include <iostream>             // std::ostream
 #include <cmath>                // std::log, std::ceil
+#include <numeric>              // std::partial_sum
 
+#include "hnco/util.hh"         // hnco::is_in_range
 #include "hnco/bit-vector.hh"
 #include "hnco/permutation.hh"  // hnco::permutation_t
 
@@ -35,7 +38,13 @@ namespace hnco {
 namespace representation {
 
 
-/// Permutation representation
+/**
+ * Permutation representation.
+ *
+ * Each element is associated with an integer key. The permutation is
+ * obtained by sorting the elements by key. Ties are broken by element
+ * index hence the permutation only depends on the bit vector.
+ */
 class PermutationRepresentation {
 
   /// Values to be sorted
@@ -47,6 +56,26 @@ class PermutationRepresentation {
   /// Size in bits
   int _size;
 
+  /// Buffer for radix sort
+  hnco::permutation_t _buffer;
+
+  /// Counts for radix sort
+  std::vector<int> _counts;
+
+  /// Size in bits of radix sort digits
+  static constexpr int digit_size = 8;
+
+  /// Get the key of an element
+  int unpack_key(const bit_vector_t& bv, int start, int element) const {
+    start += element * _element_size;
+    return bv_to_size_type(bv, start, start + _element_size);
+  }
+
+  /// Check whether an element precedes another one
+  bool precedes(int i, int j) const {
+    return _values[i] < _values[j] || (_values[i] == _values[j] && i < j);
+  }
+
 public:
 
   /**
@@ -61,6 +90,8 @@ public:
    */
   PermutationRepresentation(int num_elements, int num_additional_bits)
     : _values(num_elements)
+    , _buffer(num_elements)
+    , _counts((1 << digit_size) + 1)
   {
     assert(num_elements > 0);
     assert(num_additional_bits > 0);
@@ -76,23 +107,75 @@ public:
   /// Size of the representation
   int size() const { return _size; }
 
-  /// Unpack bit vector into a permutation
+  /**
+   * Unpack bit vector into a permutation.
+   *
+   * Elements are sorted by key with a least significant digit radix
+   * sort. Since the sort is stable and starts from the identity,
+   * ties are broken by element index.
+   */
   void unpack(const bit_vector_t& bv, int start, hnco::permutation_t& permutation) {
     assert(start >= 0);
     assert(permutation.size() == _values.size());
 
-    for (size_t i = 0; i < _values.size(); i++) {
-      permutation[i] = i;
-      _values[i] = bv_to_size_type(bv, start, start + _element_size);
-      start += _element_size;
+    for (size_t i = 0; i < _values.size(); i++)
+      _values[i] = unpack_key(bv, start, i);
+
+    perm_identity(permutation);
+    const int mask = (1 << digit_size) - 1;
+    for (int shift = 0; shift < _element_size; shift += digit_size) {
+      std::fill(_counts.begin(), _counts.end(), 0);
+      for (auto i : permutation)
+        _counts[((_values[i] >> shift) & mask) + 1]++;
+      std::partial_sum(_counts.begin(), _counts.end(), _counts.begin());
+      for (auto i : permutation)
+        _buffer[_counts[(_values[i] >> shift) & mask]++] = i;
+      permutation.swap(_buffer);
     }
-    perm_shuffle(permutation);
-    auto compare = [this](int i, int j){ return _values[i] < _values[j]; };
-    std::sort(permutation.begin(), permutation.end(), compare);
 
     assert(hnco::perm_is_valid(permutation));
   }
 
+  /**
+   * Update a permutation after a change of some keys.
+   *
+   * Each element the key of which has changed is moved to its new
+   * position. The result is the same as the one of unpack.
+   *
+   * @param bv Bit vector
+   * @param start Start bit
+   * @param permutation Permutation given by the last call to unpack or update
+   * @param elements Elements the keys of which might have changed
+   */
+  void update(const bit_vector_t& bv, int start, hnco::permutation_t& permutation, const std::vector<int>& elements) {
+    assert(start >= 0);
+    assert(permutation.size() == _values.size());
+
+    for (auto e : elements) {
+      assert(hnco::is_in_range(e, _values.size()));
+      int key = unpack_key(bv, start, e);
+      if (key == _values[e])
+        continue;
+      _values[e] = key;
+      auto it = std::find(permutation.begin(), permutation.end(), e);
+      assert(it != permutation.end());
+      while (it != permutation.begin() && precedes(e, *(it - 1))) {
+        *it = *(it - 1);
+        it--;
+      }
+      while (it + 1 != permutation.end() && precedes(*(it + 1), e)) {
+        *it = *(it + 1);
+        it++;
+      }
+      *it = e;
+    }
+
+    assert(hnco::perm_is_valid(permutation));
+  }
+
+  /// Get the element associated with a bit
+  int get_element(int start, int index) const { return (index - start) / _element_size; }
+
   /// Display
   void display(std::ostream& stream) const {
     stream << "PermutationRepresentation: "
@@ -0,0 +1,93 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <cstring>              // std::memcpy, std::memcmp
+
+#include "serialization.hh"
+
+
+using namespace hnco;
+
+
+std::uint64_t
+hnco::fnv1a_checksum(const char *data, std::size_t size, std::uint64_t hash)
+{
+  for (std::size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+bool
+hnco::is_binary_archive(std::string path)
+{
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream.good())
+    return false;
+  char magic[sizeof(binary_archive_magic)];
+  stream.read(magic, sizeof(magic));
+  if (!stream.good())
+    return false;
+  return std::memcmp(magic, binary_archive_magic, sizeof(magic)) == 0;
+}
+
+const char *
+hnco::get_binary_archive_payload(const MappedFile& file, std::string name)
+{
+  BinaryArchiveHeader header;
+  if (file.size() < sizeof(header))
+    throw std::runtime_error(name + "::load: Truncated header");
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  if (std::memcmp(header.magic, binary_archive_magic, sizeof(header.magic)) != 0)
+    throw std::runtime_error(name + "::load: Not a binary archive");
+  if (header.version != binary_archive_version)
+    throw std::runtime_error(name + "::load: Unsupported version: " + std::to_string(header.version));
+
+  std::size_t offset = sizeof(header);
+  if (file.size() - offset < header.name_size)
+    throw std::runtime_error(name + "::load: Truncated class name");
+  if (std::string(file.data() + offset, header.name_size) != name)
+    throw std::runtime_error(name + "::load: Class mismatch: " + std::string(file.data() + offset, header.name_size));
+  offset += header.name_size;
+
+  if (file.size() - offset != header.payload_size)
+    throw std::runtime_error(name + "::load: Bad payload size");
+  const char *payload = file.data() + offset;
+  if (fnv1a_checksum(payload, header.payload_size) != header.checksum)
+    throw std::runtime_error(name + "::load: Bad checksum");
+
+  return payload;
+}
+
+void
+hnco::write_binary_archive_header(std::ostream& stream, std::string name,
+                                  std::uint64_t payload_size, std::uint64_t checksum)
+{
+  BinaryArchiveHeader header;
+  std::memcpy(header.magic, binary_archive_magic, sizeof(header.magic));
+  header.version = binary_archive_version;
+  header.name_size = name.size();
+  header.payload_size = payload_size;
+  header.checksum = checksum;
+  stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  stream.write(name.data(), name.size());
+}
@@ -21,21 +21,248 @@
 #ifndef HNCO_SERIALIZATION_H
 #define HNCO_SERIALIZATION_H
 
+#include <cstdint>              // std::uint32_t, std::uint64_t
 #include <fstream>              // std::ifstream, std::ofstream
+#include <istream>              // std::istream
+#include <streambuf>            // std::streambuf
 #include <string>               // std::string
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
+#include "hnco/mapped-file.hh"
+
 
 namespace hnco {
 
 
+/** @name Binary instance format
+
+    A binary instance file starts with a BinaryArchiveHeader, followed
+    by the class name, followed by the payload which is a boost binary
+    archive. The payload is protected by a 64-bit FNV-1a checksum.
+
+    At save time, the payload is written to the file as it is
+    produced, through a ChecksumBuffer, and the header is completed
+    afterwards. Hence no copy of the payload is kept in memory.
+
+    At load time, the file is memory-mapped read-only so that
+    concurrent processes loading the same instance share its pages
+    through the page cache.
+
+    The payload is a boost binary archive, hence it is not portable
+    across architectures with different endianness or type sizes.
+ */
+///@{
+
+/// Binary archive header
+struct BinaryArchiveHeader {
+
+  /// Magic number
+  char magic[8];
+
+  /// Format version
+  std::uint32_t version;
+
+  /// Size of the class name
+  std::uint32_t name_size;
+
+  /// Size of the payload
+  std::uint64_t payload_size;
+
+  /// Checksum of the payload
+  std::uint64_t checksum;
+
+};
+
+/// Magic number of binary archives
+constexpr char binary_archive_magic[8] = {'H', 'N', 'C', 'O', 'B', 'I', 'N', '\0'};
+
+/// Version of the binary archive format
+constexpr std::uint32_t binary_archive_version = 1;
+
+/// Offset basis of the 64-bit FNV-1a checksum
+constexpr std::uint64_t fnv1a_offset_basis = 0xcbf29ce484222325;
+
+/** Compute a 64-bit FNV-1a checksum.
+
+    The checksum of a concatenation is computed by passing the
+    checksum of the first part as initial value for the second part.
+
+    \param data Data
+    \param size Number of bytes
+    \param hash Initial value
+*/
+std::uint64_t fnv1a_checksum(const char *data, std::size_t size, std::uint64_t hash = fnv1a_offset_basis);
+
+/** Check whether a file is a binary archive.
+
+    Only the magic number is checked.
+
+    \param path Path of the file
+    \return false if the file cannot be opened or does not start with
+    the magic number
+*/
+bool is_binary_archive(std::string path);
+
+
+/// Read-only stream buffer over a memory region
+class MemoryBuffer: public std::streambuf {
+
+public:
+
+  /** Constructor.
+      \param data Data
+      \param size Number of bytes
+  */
+  MemoryBuffer(const char *data, std::size_t size) {
+    char *begin = const_cast<char *>(data);
+    setg(begin, begin, begin + size);
+  }
+
+};
+
+
+/** Get the payload of a binary archive.
+
+    Checks the magic number, the version, the class name, the payload
+    size and the checksum.
+
+    \param file Mapped file
+    \param name Class name
+    \return Pointer to the payload whose size is given by the header
+    \throw std::runtime_error
+*/
+const char *get_binary_archive_payload(const MappedFile& file, std::string name);
+
+/** Write the header and the class name of a binary archive.
+    \param stream Output stream
+    \param name Class name
+    \param payload_size Size of the payload
+    \param checksum Checksum of the payload
+*/
+void write_binary_archive_header(std::ostream& stream, std::string name,
+                                 std::uint64_t payload_size, std::uint64_t checksum);
+
+
+/** Write-only stream buffer which computes a checksum.
+
+    Bytes are forwarded to another stream buffer. Their number and
+    their FNV-1a checksum are updated on the fly.
+*/
+class ChecksumBuffer: public std::streambuf {
+
+  /// Destination
+  std::streambuf *_destination;
+
+  /// Number of bytes
+  std::uint64_t _size = 0;
+
+  /// Checksum
+  std::uint64_t _checksum = fnv1a_offset_basis;
+
+protected:
+
+  /// Write a single character
+  int_type overflow(int_type c) override {
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+      return traits_type::not_eof(c);
+    char ch = traits_type::to_char_type(c);
+    return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+  }
+
+  /// Write a sequence of characters
+  std::streamsize xsputn(const char *data, std::streamsize size) override {
+    std::streamsize result = _destination->sputn(data, size);
+    _checksum = fnv1a_checksum(data, result, _checksum);
+    _size += result;
+    return result;
+  }
+
+public:
+
+  /** Constructor.
+      \param destination Destination
+  */
+  ChecksumBuffer(std::streambuf *destination):
+    _destination(destination) {}
+
+  /// Get the number of bytes
+  std::uint64_t get_size() const { return _size; }
+
+  /// Get the checksum
+  std::uint64_t get_checksum() const { return _checksum; }
+
+};
+
+/** Load from a binary archive.
+    \param object Object to load
+    \param path Path of the file
+    \param name Class name
+*/
+template<typename T>
+void load_from_binary_archive(T& object, std::string path, std::string name)
+{
+  MappedFile file(path);
+  const char *payload = get_binary_archive_payload(file, name);
+  MemoryBuffer buffer(payload, file.data() + file.size() - payload);
+  std::istream stream(&buffer);
+  try {
+    boost::archive::binary_iarchive archive(stream);
+    archive >> object;
+  }
+  catch (boost::archive::archive_exception& e) {
+    throw std::runtime_error(name + "::load: " + std::string(e.what()));
+  }
+}
+
+/** Save to a binary archive.
+    \param object Object to save
+    \param path Path of the file
+    \param name Class name
+*/
+template<typename T>
+void save_to_binary_archive(const T& object, std::string path, std::string name)
+{
+  std::ofstream stream(path, std::ios::binary);
+  if (!stream.good())
+    throw std::runtime_error(name + "::save: Cannot open " + path);
+  write_binary_archive_header(stream, name, 0, 0);
+
+  ChecksumBuffer buffer(stream.rdbuf());
+  {
+    std::ostream payload(&buffer);
+    try {
+      boost::archive::binary_oarchive archive(payload);
+      archive << object;
+    }
+    catch (boost::archive::archive_exception& e) {
+      throw std::runtime_error(name + "::save: " + std::string(e.what()));
+    }
+    if (!payload.good())
+      throw std::runtime_error(name + "::save: Cannot write " + path);
+  }
+
+  stream.seekp(0);
+  write_binary_archive_header(stream, name, buffer.get_size(), buffer.get_checksum());
+  if (!stream.good())
+    throw std::runtime_error(name + "::save: Cannot write " + path);
+}
+
+///@}
+
+
 /** @name Load from and save to boost archives
  */
 ///@{
 
 /** Load from a boost archive.
+
+    Binary archives are detected by their magic number and loaded
+    with load_from_binary_archive.
+
     \param object Object to load
     \param path Path of the file
     \param name Class name
@@ -43,6 +270,10 @@ namespace hnco {
 template<typename T>
 void load_from_archive(T& object, std::string path, std::string name)
 {
+  if (is_binary_archive(path)) {
+    load_from_binary_archive(object, path, name);
+    return;
+  }
   std::ifstream stream(path);
   if (!stream.good())
     throw std::runtime_error(name + "::load: Cannot open " + path);
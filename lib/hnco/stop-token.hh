@@ -0,0 +1,62 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef HNCO_STOP_TOKEN_H
+#define HNCO_STOP_TOKEN_H
+
+#include <atomic>
+
+
+namespace hnco
+{
+
+/** Stop token.
+
+    A stop token is shared between function controllers, which
+    request a stop when the budget is exhausted or the target is
+    reached, and algorithms, which check it at safe points, for
+    example between iterations or before dispatching an evaluation,
+    and return normally. It is an alternative to the exceptions
+    LastEvaluation and TargetReached.
+
+    Requesting and checking a stop are lock-free and can be done
+    concurrently from several threads.
+*/
+class StopToken
+{
+  /// Stop requested
+  std::atomic<bool> _stop_requested{false};
+
+public:
+
+  /// Request a stop
+  void request_stop() { _stop_requested.store(true, std::memory_order_relaxed); }
+
+  /// Check whether a stop has been requested
+  bool stop_requested() const { return _stop_requested.load(std::memory_order_relaxed); }
+
+  /// Reset
+  void reset() { _stop_requested.store(false, std::memory_order_relaxed); }
+
+};
+
+}
+
+
+#endif
@@ -0,0 +1,142 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+/** \file
+
+    Check that parallel evaluation respects the budget exactly: no
+    evaluation is dispatched beyond the budget and unevaluated bit
+    vectors are set to -infinity.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <cmath>                // std::isinf
+
+#include "hnco/algorithms/evolutionary-algorithms/genetic-algorithm.hh"
+#include "hnco/algorithms/population.hh"
+#include "hnco/exception.hh"
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+/// OneMax counting safe evaluations
+class CountingOneMax: public OneMax {
+public:
+  int num_safe_evaluations = 0;
+  CountingOneMax(int n): OneMax(n) {}
+  double evaluate_safely(const bit_vector_t& x) override {
+    num_safe_evaluations++;
+    return OneMax::evaluate_safely(x);
+  }
+};
+
+int count_safe_evaluations(const std::vector<CountingOneMax>& copies)
+{
+  int result = 0;
+  for (const auto& copy : copies)
+    result += copy.num_safe_evaluations;
+  return result;
+}
+
+bool check_population(int n, int size, int num_threads, int budget)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<CountingOneMax> copies(num_threads, CountingOneMax(n));
+  OnBudgetFunction controller(&copies[0], budget);
+  std::vector<Function *> functions{&controller};
+  for (int k = 1; k < num_threads; k++)
+    functions.push_back(&copies[k]);
+
+  Population population(size, n);
+  int remaining = budget;
+  try {
+    for (;;) {
+      population.random();
+      population.evaluate_in_parallel(functions);
+      const int num_evaluated = std::min(size, remaining);
+      for (int i = 0; i < size; i++)
+        if (std::isinf(population.values[i]) != (i >= num_evaluated))
+          return false;
+      remaining -= num_evaluated;
+    }
+  }
+  catch (const LastEvaluation&) {}
+
+  return
+    remaining == 0 &&
+    controller.get_num_calls() == budget &&
+    count_safe_evaluations(copies) == budget;
+}
+
+bool check_ga(int n, int size, int num_threads, int budget)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<CountingOneMax> copies(num_threads, CountingOneMax(n));
+  OnBudgetFunction controller(&copies[0], budget);
+  std::vector<Function *> functions{&controller};
+  for (int k = 1; k < num_threads; k++)
+    functions.push_back(&copies[k]);
+
+  GeneticAlgorithm algorithm(n, size);
+  algorithm.set_tournament_size(2);
+  try {
+    algorithm.maximize(functions);
+    return false;
+  }
+  catch (const LastEvaluation&) {}
+
+  // The initial population is evaluated serially
+  return
+    controller.get_num_calls() == budget &&
+    count_safe_evaluations(copies) == budget - size;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 100);
+  std::uniform_int_distribution<int> size_dist(3, 50);
+  std::uniform_int_distribution<int> num_threads_dist(2, 4);
+  std::uniform_int_distribution<int> factor_dist(1, 10);
+
+  for (int i = 0; i < 20; i++) {
+    const int n = bv_size_dist(Generator::engine);
+    const int size = size_dist(Generator::engine);
+    const int num_threads = num_threads_dist(Generator::engine);
+    const int budget = size * factor_dist(Generator::engine) + size_dist(Generator::engine) - 3;
+    if (!check_population(n, size, num_threads, budget))
+      return 1;
+    if (!check_ga(n, size, num_threads, size + budget))
+      return 1;
+  }
+
+  return 0;
+}
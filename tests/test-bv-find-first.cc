@@ -0,0 +1,58 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "hnco/bit-vector.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::random;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(0, 1000);
+
+  for (int i = 0; i < 1000; i++) {
+
+    const int bv_size = bv_size_dist(Generator::engine);
+
+    // Long runs of identical bits
+    bit_vector_t x(bv_size, Generator::uniform() < 0.5 ? 0 : 1);
+    std::bernoulli_distribution flip(0.01);
+    for (auto& b : x)
+      if (flip(Generator::engine))
+        bit_flip(b);
+
+    std::uniform_int_distribution<int> index_dist(0, bv_size);
+    const std::size_t start = index_dist(Generator::engine);
+
+    for (bit_t b = 0; b < 2; b++) {
+      std::size_t index = start;
+      while (index < x.size() && x[index] != b)
+        index++;
+      if (bv_find_first(x, b, start) != index)
+        return 1;
+    }
+  }
+
+  return 0;
+}
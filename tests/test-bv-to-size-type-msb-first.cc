@@ -0,0 +1,62 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <algorithm>            // std::reverse
+
+#include "hnco/bit-vector.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::random;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> size_dist(1, 64);
+  std::uniform_int_distribution<int> start_dist(0, 16);
+
+  for (int i = 0; i < 1000; i++) {
+
+    const int size = size_dist(Generator::engine);
+    const int start = start_dist(Generator::engine);
+    const int stop = start + size;
+
+    bit_vector_t bv(stop + start_dist(Generator::engine));
+    bv_random(bv);
+
+    std::size_t expected = 0;
+    for (int j = start; j < stop; j++)
+      expected = (expected << 1) | bv[j];
+    if (bv_to_size_type_msb_first(bv, start, stop) != expected)
+      return 1;
+
+    bit_vector_t slice(bv.begin() + start, bv.begin() + stop);
+    if (bv_to_size_type(bv, start, stop) != bv_to_size_type(slice))
+      return 1;
+
+    std::reverse(slice.begin(), slice.end());
+    if (bv_to_size_type(slice) != expected)
+      return 1;
+  }
+
+  return 0;
+}
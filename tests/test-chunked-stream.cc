@@ -0,0 +1,65 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check that a ChunkedStream does not depend on the number of
+    threads nor on the batch size.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include "hnco/random.hh"
+
+using namespace hnco::random;
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> chunk_size_dist(1, 100);
+  std::uniform_int_distribution<int> batch_size_dist(1, 10);
+  std::uniform_int_distribution<int> num_threads_dist(1, 8);
+  std::uniform_int_distribution<int> length_dist(0, 2000);
+
+  for (int i = 0; i < 20; i++) {
+
+    const unsigned seed = Generator::engine();
+    const int chunk_size = chunk_size_dist(Generator::engine);
+    const int length = length_dist(Generator::engine);
+    std::normal_distribution<double> distribution;
+
+    omp_set_num_threads(1);
+    ChunkedStream<std::normal_distribution<double>> reference(distribution, seed, chunk_size, 1);
+    std::vector<double> values(length);
+    for (auto& v: values)
+      v = reference();
+
+    omp_set_num_threads(num_threads_dist(Generator::engine));
+    ChunkedStream<std::normal_distribution<double>> stream(distribution, seed, chunk_size, batch_size_dist(Generator::engine));
+    for (auto v: values)
+      if (stream() != v)
+        return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <random>
+
+#include "hnco/algorithms/complete-search.hh"
+#include "hnco/exception.hh"
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/iterator.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check_solution(CompleteSearch& algorithm, Function& function, double maximum)
+{
+  const solution_t& solution = algorithm.get_solution();
+  return solution.second == maximum && function.evaluate(solution.first) == maximum;
+}
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 20;
+  const int num_threads         = 4;
+
+  Generator::set_seed();
+  omp_set_num_threads(num_threads);
+
+  std::uniform_int_distribution<int> bv_size_dist(1, 14);
+  std::uniform_int_distribution<int> coefficient_dist(-100, 100);
+
+  auto fn = [coefficient_dist]() mutable
+    { return coefficient_dist(Generator::engine); };
+
+  for (int i = 0; i < num_runs; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+
+    WalshExpansion2 function;
+    function.generate(bv_size, fn, fn);
+
+    // Maximum by enumeration in lexicographic order
+    double maximum = 0;
+    HypercubeIterator iterator(bv_size);
+    for (bool first = true; iterator.has_next(); first = false) {
+      double value = function.evaluate(iterator.next());
+      if (first || value > maximum)
+        maximum = value;
+    }
+
+    // Serial search
+    {
+      WalshExpansion2 copy = function;
+      CompleteSearch algorithm(bv_size);
+      algorithm.maximize({&copy});
+      if (!check_solution(algorithm, function, maximum))
+        return 1;
+    }
+
+    // Parallel search
+    {
+      std::vector<WalshExpansion2> copies(num_threads, function);
+      std::vector<Function *> fns;
+      for (auto& copy : copies)
+        fns.push_back(&copy);
+      CompleteSearch algorithm(bv_size);
+      algorithm.maximize(fns);
+      if (!check_solution(algorithm, function, maximum))
+        return 1;
+    }
+
+    // Parallel search: all evaluations are accounted for
+    {
+      std::vector<WalshExpansion2> copies(num_threads, function);
+      ProgressTracker tracker(&copies[0]);
+      std::vector<Function *> fns{&tracker};
+      for (int k = 1; k < num_threads; k++)
+        fns.push_back(&copies[k]);
+      CompleteSearch algorithm(bv_size);
+      algorithm.maximize(fns);
+      const int size = 1 << bv_size;
+      if (tracker.get_num_calls() != size)
+        return 1;
+      const auto& last_improvement = tracker.get_last_improvement();
+      if (last_improvement.solution.second != maximum)
+        return 1;
+      if (last_improvement.num_evaluations < 1 || last_improvement.num_evaluations > size)
+        return 1;
+    }
+
+    // Parallel search on a budget
+    {
+      const int size = 1 << bv_size;
+      std::uniform_int_distribution<int> budget_dist(1, size);
+      const int budget = budget_dist(Generator::engine);
+      std::vector<WalshExpansion2> copies(num_threads, function);
+      OnBudgetFunction controller(&copies[0], budget);
+      std::vector<Function *> fns{&controller};
+      for (int k = 1; k < num_threads; k++)
+        fns.push_back(&copies[k]);
+      CompleteSearch algorithm(bv_size);
+      try {
+        algorithm.maximize(fns);
+      }
+      catch (const LastEvaluation&) {}
+      if (controller.get_num_calls() != budget)
+        return 1;
+      const solution_t& solution = algorithm.get_solution();
+      if (function.evaluate(solution.first) != solution.second)
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check that CompleteSearch reports the exact value of its solution
+    on a function with real coefficients evaluated incrementally, in
+    serial and parallel modes, and that ProgressTracker counts every
+    bit vector once and agrees with the solution.
+
+*/
+
+#include <math.h>               // std::abs
+#include <omp.h>                // omp_set_num_threads
+
+#include "hnco/algorithms/complete-search.hh"
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/iterator.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check_tracker(CompleteSearch& algorithm, ProgressTracker& tracker)
+{
+  const solution_t& solution = algorithm.get_solution();
+  const auto& last_improvement = tracker.get_last_improvement();
+  return
+    tracker.get_num_calls() == (1 << algorithm.get_bv_size()) &&
+    last_improvement.solution.second == solution.second;
+}
+
+bool check_solution(CompleteSearch& algorithm, Function& function, double maximum)
+{
+  const solution_t& solution = algorithm.get_solution();
+  return
+    function.evaluate(solution.first) == solution.second &&
+    std::abs(solution.second - maximum) < 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 10;
+  const int num_threads         = 4;
+
+  Generator::set_seed();
+  omp_set_num_threads(num_threads);
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 16);
+
+  for (int i = 0; i < num_runs; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+
+    WalshExpansion2 function;
+    function.generate(bv_size, Generator::normal, Generator::normal);
+
+    // Maximum by enumeration in lexicographic order
+    double maximum = 0;
+    HypercubeIterator iterator(bv_size);
+    for (bool first = true; iterator.has_next(); first = false) {
+      double value = function.evaluate(iterator.next());
+      if (first || value > maximum)
+        maximum = value;
+    }
+
+    // Serial search
+    {
+      WalshExpansion2 copy = function;
+      ProgressTracker tracker(&copy);
+      CompleteSearch algorithm(bv_size);
+      algorithm.maximize({&tracker});
+      if (!check_solution(algorithm, function, maximum))
+        return 1;
+      if (!check_tracker(algorithm, tracker))
+        return 1;
+    }
+
+    // Parallel search
+    {
+      std::vector<WalshExpansion2> copies(num_threads, function);
+      ProgressTracker tracker(&copies[0]);
+      std::vector<Function *> fns{&tracker};
+      for (int k = 1; k < num_threads; k++)
+        fns.push_back(&copies[k]);
+      CompleteSearch algorithm(bv_size);
+      algorithm.maximize(fns);
+      if (!check_solution(algorithm, function, maximum))
+        return 1;
+      if (!check_tracker(algorithm, tracker))
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check that UniformCrossover and BiasedCrossover take each bit from
+    one of the parents with the expected probability.
+
+*/
+
+#include <math.h>               // std::abs, std::sqrt
+
+#include "hnco/algorithms/evolutionary-algorithms/crossover.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check(Crossover& crossover, double bias, int n)
+{
+  const int num_samples = 1000;
+
+  bit_vector_t parent1(n), parent2(n), offspring(n);
+  bv_random(parent1);
+  for (int i = 0; i < n; i++)
+    parent2[i] = 1 - parent1[i];
+
+  // Parents differ everywhere hence bits from parent2 can be counted
+  double count = 0;
+  for (int k = 0; k < num_samples; k++) {
+    crossover.recombine(parent1, parent2, offspring);
+    for (int i = 0; i < n; i++)
+      if (offspring[i] == parent2[i])
+        count++;
+  }
+
+  // In-place recombination with the first parent as offspring
+  bit_vector_t copy = parent1;
+  crossover.recombine(copy, parent2, copy);
+  for (int i = 0; i < n; i++)
+    if (copy[i] != parent1[i] && copy[i] != parent2[i])
+      return false;
+
+  const double total = double(num_samples) * n;
+  return std::abs(count / total - bias) < 5 * std::sqrt(bias * (1 - bias) / total);
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  for (int n : {1, 7, 31, 32, 33, 100, 1000}) {
+    UniformCrossover uniform;
+    if (!check(uniform, 0.5, n))
+      return 1;
+    for (double bias : {0.01, 0.1, 0.3, 0.5, 0.7, 0.9, 0.99}) {
+      BiasedCrossover biased;
+      biased.set_bias(bias);
+      if (!check(biased, bias, n))
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check DeltaPopulation::evaluate and
+    DeltaPopulation::evaluate_in_parallel against full evaluation of
+    materialized individuals.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include "hnco/algorithms/delta-population.hh"
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/functions/modifiers/modifier.hh"
+#include "hnco/maps/map.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::function::modifier;
+using namespace hnco::function;
+using namespace hnco::map;
+using namespace hnco::random;
+using namespace hnco;
+
+bool check(bool incremental)
+{
+  std::uniform_int_distribution<int> dist_population_size(1, 100);
+  std::uniform_int_distribution<int> dist_n(1, 100);
+  std::uniform_int_distribution<int> dist_num_threads(1, 10);
+
+  for (int i = 0; i < 10; i++) {
+
+    const int mu                = dist_population_size  (Generator::engine);
+    const int lambda            = dist_population_size  (Generator::engine);
+    const int n                 = dist_n                (Generator::engine);
+    const int num_threads       = dist_num_threads      (Generator::engine);
+
+    omp_set_num_threads(num_threads);
+
+    Translation tr;
+    tr.random(n);
+    std::vector<OneMax> oms(num_threads, OneMax(n));
+    std::vector<FunctionMapComposition> fms;
+    for (int k = 0; k < num_threads; k++)
+      fms.push_back(FunctionMapComposition(&oms[k], &tr));
+    std::vector<Function *> fns;
+    for (int k = 0; k < num_threads; k++)
+      if (incremental)
+        fns.push_back(&oms[k]);
+      else
+        fns.push_back(&fms[k]);
+    assert(fns[0]->provides_incremental_evaluation() == incremental);
+
+    Population parents(mu, n);
+    parents.random();
+    parents.evaluate(fns[0]);
+
+    DeltaPopulation offsprings(lambda, n);
+    std::uniform_int_distribution<int> dist_parent(0, mu - 1);
+    bit_vector_t bv(n);
+    for (int j = 0; j < lambda; j++) {
+      offsprings.parents[j] = dist_parent(Generator::engine);
+      bv_random(bv);
+      for (int k = 0; k < n; k++)
+        if (bv[k])
+          offsprings.flipped_bits[j].push_back(k);
+    }
+
+    DeltaPopulation offsprings_par(offsprings);
+    offsprings.evaluate(parents, fns[0]);
+    offsprings_par.evaluate_in_parallel(parents, fns);
+
+    for (int j = 0; j < lambda; j++) {
+      offsprings.materialize(j, parents, bv);
+      double value = fns[0]->evaluate(bv);
+      if (offsprings.values[j] != value)
+        return false;
+      if (offsprings_par.values[j] != value)
+        return false;
+    }
+
+  }
+
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+  if (!check(true))
+    return 1;
+  if (!check(false))
+    return 1;
+  return 0;
+}
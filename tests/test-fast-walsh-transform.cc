@@ -0,0 +1,107 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "hnco/mapped-file.hh"
+#include "hnco/random.hh"
+#include "hnco/functions/all.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  // Fast versus naive transform
+
+  std::uniform_int_distribution<int> small_size_dist(1, 10);
+
+  for (int i = 0; i < 20; i++) {
+    const int bv_size = small_size_dist(Generator::engine);
+
+    Plateau function(bv_size);
+    Plateau copy(bv_size);
+    std::vector<function::WalshTerm> expected;
+    compute_walsh_transform(&function, expected);
+
+    std::vector<double> coefficients;
+    compute_fast_walsh_transform(std::vector<Function *>{&function, &copy}, coefficients);
+
+    std::vector<function::WalshTerm> terms;
+    compute_fast_walsh_transform(&function, terms);
+
+    if (terms.size() != expected.size())
+      return 1;
+    bit_vector_t bv(bv_size);
+    for (size_t j = 0; j < terms.size(); j++) {
+      if (terms[j].feature != expected[j].feature ||
+          terms[j].coefficient != expected[j].coefficient)
+        return 1;
+      bv_from_vector_bool(bv, terms[j].feature);
+      if (coefficients[bv_to_size_type(bv)] != expected[j].coefficient)
+        return 1;
+    }
+  }
+
+  // The transform applied twice multiplies values by their number
+
+  std::uniform_int_distribution<int> size_dist(0, 18);
+  std::uniform_int_distribution<int> value_dist(-100, 100);
+
+  for (int i = 0; i < 20; i++) {
+    const std::size_t size = std::size_t(1) << size_dist(Generator::engine);
+
+    std::vector<double> values(size);
+    for (auto& v : values)
+      v = value_dist(Generator::engine);
+
+    std::vector<double> transformed = values;
+    fast_walsh_transform(transformed);
+    fast_walsh_transform(transformed);
+
+    for (std::size_t j = 0; j < size; j++)
+      if (transformed[j] != size * values[j])
+        return 1;
+  }
+
+  // Memory-mapped array
+
+  {
+    const int bv_size = 14;
+    const std::size_t size = std::size_t(1) << bv_size;
+
+    Plateau function(bv_size);
+    std::vector<double> expected;
+    compute_fast_walsh_transform(std::vector<Function *>{&function}, expected);
+
+    MappedFile file("test-fast-walsh-transform.bin", size * sizeof(double));
+    double *coefficients = reinterpret_cast<double *>(file.writable_data());
+    evaluate_on_hypercube(std::vector<Function *>{&function}, coefficients);
+    fast_walsh_transform(coefficients, size);
+
+    for (std::size_t j = 0; j < size; j++)
+      if (coefficients[j] != expected[j])
+        return 1;
+  }
+
+  return 0;
+}
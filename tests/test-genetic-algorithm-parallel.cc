@@ -0,0 +1,86 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check that GeneticAlgorithm gives the same results for the same
+    seed and number of threads when offsprings are generated in
+    parallel.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include "hnco/algorithms/evolutionary-algorithms/genetic-algorithm.hh"
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+solution_t run(const WalshExpansion2& function, int population_size, int num_threads, unsigned seed)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<WalshExpansion2> copies(num_threads, function);
+  std::vector<Function *> functions;
+  for (auto& copy : copies)
+    functions.push_back(&copy);
+
+  Generator::set_seed(seed);
+  GeneticAlgorithm algorithm(function.get_bv_size(), population_size);
+  algorithm.set_num_iterations(20);
+  algorithm.maximize(functions);
+  algorithm.finalize();
+  return algorithm.get_solution();
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 100);
+  std::uniform_int_distribution<int> population_size_dist(20, 100);
+  std::uniform_int_distribution<int> num_threads_dist(2, 4);
+
+  for (int i = 0; i < 10; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    const int population_size = population_size_dist(Generator::engine);
+    const int num_threads = num_threads_dist(Generator::engine);
+    const unsigned seed = Generator::engine();
+
+    WalshExpansion2 function;
+    function.generate(bv_size, Generator::normal, Generator::normal);
+
+    auto a = run(function, population_size, num_threads, seed);
+    auto b = run(function, population_size, num_threads, seed);
+    if (a != b)
+      return 1;
+    if (function.evaluate(a.first) != a.second)
+      return 1;
+
+    Generator::set_seed(seed + 1);
+  }
+
+  return 0;
+}
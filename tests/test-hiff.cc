@@ -0,0 +1,77 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <algorithm>            // std::all_of
+
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+double
+naive_hiff(const bit_vector_t& x)
+{
+  double result = 0;
+  for (int num_blocks = x.size(), block_size = 1; num_blocks > 0; num_blocks /= 2, block_size *= 2) {
+    bool last = true;
+    for (int j = 0, offset = 0; j < num_blocks; j++, offset += block_size) {
+      bit_t b0 = x[offset];
+      if (std::all_of(x.begin() + offset, x.begin() + offset + block_size, [b0](bit_t b){ return b == b0; })) {
+        result += block_size;
+        last = false;
+      }
+    }
+    if (last)
+      break;
+  }
+  return result;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> depth_dist(0, 10);
+
+  for (int i = 0; i < 1000; i++) {
+
+    const int bv_size = 1 << depth_dist(Generator::engine);
+    Hiff function(bv_size);
+
+    // Start from a uniform vector and flip a few bits
+    bit_vector_t x(bv_size, Generator::uniform() < 0.5 ? 0 : 1);
+    std::uniform_int_distribution<int> index_dist(0, bv_size - 1);
+    const int num_flips = std::uniform_int_distribution<int>(0, 3)(Generator::engine);
+    for (int j = 0; j < num_flips; j++)
+      bv_flip(x, index_dist(Generator::engine));
+
+    if (function.evaluate(x) != naive_hiff(x))
+      return 1;
+
+    bv_random(x);
+    if (function.evaluate(x) != naive_hiff(x))
+      return 1;
+  }
+
+  return 0;
+}
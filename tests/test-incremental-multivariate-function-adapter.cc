@@ -0,0 +1,84 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <random>
+
+#include "hnco/functions/collection/parsed-multivariate-function.hh"
+#include "hnco/functions/converter.hh"
+#include "hnco/functions/multivariate-function-adapter.hh"
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::neighborhood;
+using namespace hnco::random;
+using namespace hnco::representation;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 100;
+  const int num_iterations      = 100;
+
+  using Fn      = ParsedMultivariateFunction<FunctionParser>;
+  using Rep     = DyadicFloatRepresentation<double>;
+  using Conv    = ScalarToDouble<double>;
+  using Adapter = MultivariateFunctionAdapter<Fn, Rep, Conv>;
+
+  std::uniform_int_distribution<int> dist(1, 32);
+
+  Generator::set_seed();
+
+  for (int i = 0; i < num_runs; i++) {
+    Fn fn("x + 2 * y - z * z + x * y * z");
+    fn.parse();
+    std::vector<Rep> reps(fn.get_num_variables(), Rep(-1.0, 1.0, dist(Generator::engine)));
+    Adapter function(&fn, reps);
+    Adapter memo_function(&fn, reps);
+    memo_function.set_memo(true);
+
+    const int bv_size = function.get_bv_size();
+    StandardBitMutation neighborhood(bv_size);
+    bit_vector_t bv(bv_size);
+
+    bv_random(bv);
+    neighborhood.set_origin(bv);
+    for (int j = 0; j < num_iterations; j++) {
+      double value = function.evaluate(neighborhood.get_origin());
+      if (memo_function.evaluate(neighborhood.get_origin()) != value)
+        return 1;
+      neighborhood.propose();
+      double candidate_value = function.evaluate(neighborhood.get_candidate());
+      if (memo_function.evaluate_incrementally(neighborhood.get_origin(),
+                                               value,
+                                               neighborhood.get_flipped_bits()) != candidate_value)
+        return 1;
+      if (memo_function.evaluate(neighborhood.get_candidate()) != candidate_value)
+        return 1;
+      if (Generator::bernoulli())
+        neighborhood.keep();
+      else
+        neighborhood.forget();
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <random>
+
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::neighborhood;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 100;
+  const int num_iterations      = 100;
+
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(1, 100);
+  std::uniform_int_distribution<int> coefficient_dist(-100, 100);
+
+  auto fn = [coefficient_dist]() mutable
+    { return coefficient_dist(Generator::engine); };
+
+  for (int i = 0; i < num_runs; i++) {
+    int bv_size = bv_size_dist(Generator::engine);
+
+    WalshExpansion2 function;
+    function.generate(bv_size, fn, fn);
+
+    StandardBitMutation neighborhood(bv_size);
+    bit_vector_t bv(bv_size);
+    bv_random(bv);
+    neighborhood.set_origin(bv);
+    std::vector<double> gains;
+    for (int j = 0; j < num_iterations; j++) {
+      const bit_vector_t& origin = neighborhood.get_origin();
+      double value = function.evaluate(origin);
+      neighborhood.propose();
+      if (function.evaluate(neighborhood.get_candidate()) !=
+          function.evaluate_incrementally(origin,
+                                          value,
+                                          neighborhood.get_flipped_bits()))
+        return 1;
+      function.compute_flip_gains(origin, gains);
+      bv = origin;
+      for (int k = 0; k < bv_size; k++) {
+        bv_flip(bv, k);
+        if (function.evaluate(bv) != value + gains[k])
+          return 1;
+        bv_flip(bv, k);
+      }
+      if (Generator::bernoulli())
+        neighborhood.keep();
+      else
+        neighborhood.forget();
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <random>
+
+#include "hnco/functions/collection/walsh/walsh-expansion.hh"
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::neighborhood;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+double evaluate_terms(const std::vector<WalshTerm>& terms, const bit_vector_t& x)
+{
+  double result = 0;
+  for (const auto& t : terms)
+    if (bv_dot_product(x, t.feature))
+      result -= t.coefficient;
+    else
+      result += t.coefficient;
+  return result;
+}
+
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 100;
+  const int num_iterations      = 100;
+
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(1, 200);
+  std::uniform_int_distribution<int> num_terms_dist(1, 100);
+  std::uniform_int_distribution<int> order_dist(1, 4);
+  std::uniform_int_distribution<int> coefficient_dist(-100, 100);
+
+  auto fn = [coefficient_dist]() mutable
+    { return coefficient_dist(Generator::engine); };
+
+  for (int i = 0; i < num_runs; i++) {
+    int bv_size = bv_size_dist(Generator::engine);
+    int num_terms = num_terms_dist(Generator::engine);
+
+    WalshExpansion function;
+    std::vector<WalshTerm> terms;
+
+    bit_vector_t bv(bv_size);
+    std::uniform_int_distribution<int> variable_dist(0, bv_size - 1);
+    for (int t = 0; t < num_terms; t++) {
+      std::vector<bool> feature(bv_size);
+      if (i % 2) {
+        // Dense features
+        bv_random(bv);
+        bv_to_vector_bool(feature, bv);
+      } else {
+        // Sparse features
+        int order = order_dist(Generator::engine);
+        for (int k = 0; k < order; k++)
+          feature[variable_dist(Generator::engine)] = true;
+      }
+      terms.push_back({.feature = feature, .coefficient = double(fn())});
+    }
+    function.set_terms(terms);
+
+    StandardBitMutation neighborhood(bv_size);
+    bv_random(bv);
+    neighborhood.set_origin(bv);
+    for (int j = 0; j < num_iterations; j++) {
+      double value = function.evaluate(neighborhood.get_origin());
+      if (value != evaluate_terms(terms, neighborhood.get_origin()))
+        return 1;
+      neighborhood.propose();
+      if (function.evaluate(neighborhood.get_candidate()) !=
+          function.evaluate_incrementally(neighborhood.get_origin(),
+                                          value,
+                                          neighborhood.get_flipped_bits()))
+        return 1;
+      neighborhood.keep();
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+/** \file
+
+    Check that lines logged concurrently from several threads are all
+    written to the stream of the log sink, unmixed, that values are
+    formatted as by a stream, and that a progress tracker flushes the
+    sink when logging stops.
+
+*/
+
+#include <omp.h>
+
+#include <iostream>             // std::cout
+#include <sstream>              // std::ostringstream, std::istringstream
+#include <string>
+#include <vector>
+
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/logging/log-sink.hh"
+#include "hnco/logging/logger.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::logging;
+using namespace hnco::random;
+
+
+bool check_format(double x)
+{
+  std::ostringstream stream;
+  stream << x;
+  std::string line;
+  append_value(line, x);
+  return line == stream.str();
+}
+
+bool check_threads(int num_threads, int num_lines)
+{
+  std::ostringstream stream;
+  LogSink::get().set_stream(stream);
+
+#pragma omp parallel for num_threads(num_threads)
+  for (int i = 0; i < num_lines; i++) {
+    Logger logger;
+    logger << i << "line" << 0.5 * i;
+  }
+
+  LogSink::get().set_stream(std::cout);
+
+  std::vector<bool> seen(num_lines, false);
+  std::istringstream input(stream.str());
+  std::string line;
+  int count = 0;
+  while (std::getline(input, line)) {
+    std::istringstream fields(line);
+    int i;
+    std::string word;
+    double x;
+    if (!(fields >> i >> word >> x))
+      return false;
+    if (i < 0 || i >= num_lines || seen[i] || word != "line" || x != 0.5 * i)
+      return false;
+    seen[i] = true;
+    count++;
+  }
+  return count == num_lines;
+}
+
+bool check_tracker(int bv_size)
+{
+  std::ostringstream stream;
+  LogSink::get().set_stream(stream);
+
+  OneMax function(bv_size);
+  ProgressTracker tracker(&function);
+  tracker.set_log_improvement(true);
+  hnco::bit_vector_t bv(bv_size, 0);
+  for (int i = 0; i < bv_size; i++) {
+    bv[i] = 1;
+    tracker.evaluate(bv);
+  }
+
+  // No explicit flush
+  tracker.set_log_improvement(false);
+  const std::string log = stream.str();
+
+  LogSink::get().set_stream(std::cout);
+
+  std::istringstream input(log);
+  int num_evaluations;
+  double value;
+  for (int i = 0; i < bv_size; i++) {
+    if (!(input >> num_evaluations >> value))
+      return false;
+    if (num_evaluations != i + 1 || value != i + 1)
+      return false;
+  }
+  return !(input >> num_evaluations);
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::normal_distribution<double> dist(0, 1e3);
+  for (int i = 0; i < 1000; i++)
+    if (!check_format(dist(Generator::engine)))
+      return 1;
+  for (double x : {0.0, 1.0, -1.0, 1e-10, 1e10, 123456789.0})
+    if (!check_format(x))
+      return 1;
+
+  for (int num_threads : {1, 4})
+    for (int num_lines : {0, 10, 20000})
+      if (!check_threads(num_threads, num_lines))
+        return 1;
+
+  if (!check_tracker(100))
+    return 1;
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check the packed contingency tables of Mimic against a reference
+    computation which gathers the bits of selected bit vectors one at
+    a time: tables, chain and conditional parameters must be identical
+    for selection sizes which are not multiples of 64 and several
+    numbers of threads. Also check that runs with the same seed give
+    the same solution whatever the number of threads.
+
+*/
+
+#include <math.h>               // std::log
+#include <omp.h>                // omp_set_num_threads
+
+#include <algorithm>            // std::min, std::min_element, std::swap, std::transform
+
+#include "hnco/algorithms/mimic.hh"
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+/// Mimic with access to its model
+class TestMimic: public Mimic {
+
+public:
+
+  using Mimic::Mimic;
+
+  /// Sample a random population and sort it
+  void set_random_population() {
+    for (int i = 0; i < _population.get_size(); i++) {
+      bv_random(_population.bvs[i]);
+      _population.values[i] = Generator::normal();
+    }
+    _population.sort();
+  }
+
+  /// Compare packed tables with tables gathered bit by bit
+  bool check_tables() {
+    compute_columns();
+    const int n = get_bv_size();
+    for (int first = 0; first < n; first++)
+      for (int second = 0; second < n; second++) {
+        if (second == first)
+          continue;
+        table_t expected{};
+        for (int k = 0; k < _selection_size; k++) {
+          const bit_vector_t& bv = _population.get_best_bv(k);
+          expected[bv[first]][bv[second]]++;
+        }
+        table_t table;
+        compute_table(first, second, table);
+        if (table != expected)
+          return false;
+      }
+    return true;
+  }
+
+  /// Reference model computed with tables gathered bit by bit
+  void reference_model(permutation_t& permutation, std::array<pv_t, 2>& parameters) {
+    const int n = get_bv_size();
+
+    pv_t mean(n, 0);
+    for (int k = 0; k < _selection_size; k++)
+      pv_add(mean, _population.get_best_bv(k));
+    pv_average(mean, _selection_size);
+
+    std::vector<double> entropies(n);
+    std::transform(mean.begin(), mean.end(), entropies.begin(), [](double x){ return std::min(x, 1 - x); });
+    int root = std::min_element(entropies.begin(), entropies.end()) - entropies.begin();
+
+    permutation = permutation_t(n);
+    perm_identity(permutation);
+    std::swap(permutation[0], permutation[root]);
+    for (auto& p: parameters)
+      p = pv_t(n);
+    parameters[0][0] = mean[root];
+    parameters[1][0] = mean[root];
+
+    for (int i = 1; i < n; i++) {
+      int first = permutation[i - 1];
+      for (int j = i; j < n; j++) {
+        int second = permutation[j];
+        table_t table{};
+        for (int k = 0; k < _selection_size; k++) {
+          const bit_vector_t& bv = _population.get_best_bv(k);
+          table[bv[first]][bv[second]]++;
+        }
+        double entropy = 0;
+        for (size_t a = 0; a < table.size(); a++) {
+          int count = table[a][0] + table[a][1];
+          if (count) {
+            if (table[a][0])
+              entropy += table[a][0] * std::log(double(count) / table[a][0]);
+            if (table[a][1])
+              entropy += table[a][1] * std::log(double(count) / table[a][1]);
+          }
+          parameters[a][j] = count ? table[a][1] / double(count) : 0.5;
+        }
+        entropies[j] = entropy;
+      }
+      int child = std::min_element(entropies.begin() + i, entropies.end()) - entropies.begin();
+      if (child != i) {
+        std::swap(permutation[i], permutation[child]);
+        for (auto& p: parameters)
+          p[i] = p[child];
+      }
+    }
+
+    for (auto& p: parameters)
+      pv_bound(p, _lower_bound, _upper_bound);
+  }
+
+  /// Compare the model with the reference model
+  bool check_model() {
+    permutation_t permutation;
+    std::array<pv_t, 2> parameters;
+    reference_model(permutation, parameters);
+    update_model();
+    return permutation == _permutation && parameters == _parameters;
+  }
+
+};
+
+solution_t run(const WalshExpansion2& function, int population_size, int num_threads, unsigned seed)
+{
+  omp_set_num_threads(num_threads);
+
+  WalshExpansion2 copy = function;
+  Generator::set_seed(seed);
+  Mimic algorithm(function.get_bv_size(), population_size);
+  algorithm.set_num_iterations(10);
+  algorithm.maximize({&copy});
+  algorithm.finalize();
+  return algorithm.get_solution();
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(2, 50);
+
+  for (int selection_size : {1, 37, 63, 65, 100, 130, 200}) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    for (int num_threads : {1, 2, 3, 4}) {
+      omp_set_num_threads(num_threads);
+      TestMimic algorithm(bv_size, 2 * selection_size + 1);
+      algorithm.set_selection_size(selection_size);
+      algorithm.set_random_population();
+      if (!algorithm.check_tables())
+        return 1;
+      if (!algorithm.check_model())
+        return 1;
+    }
+  }
+
+  for (int i = 0; i < 5; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    const unsigned seed = Generator::engine();
+
+    WalshExpansion2 function;
+    function.generate(bv_size, Generator::normal, Generator::normal);
+
+    const solution_t reference = run(function, 101, 1, seed);
+    for (int num_threads : {2, 3, 4})
+      if (run(function, 101, num_threads, seed) != reference)
+        return 1;
+
+    Generator::set_seed(seed + 1);
+  }
+
+  return 0;
+}
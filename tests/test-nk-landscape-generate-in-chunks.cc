@@ -0,0 +1,71 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check NkLandscape::generate_in_chunks.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <algorithm>            // std::is_sorted
+
+#include "hnco/functions/collection/nk-landscape.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(2, 200);
+  std::uniform_int_distribution<int> chunk_size_dist(1, 50);
+  std::uniform_int_distribution<int> num_threads_dist(2, 8);
+
+  for (int i = 0; i < 20; i++) {
+
+    const int bv_size = bv_size_dist(Generator::engine);
+    const int k = std::uniform_int_distribution<int>(1, std::min(bv_size - 1, 5))(Generator::engine);
+    const unsigned seed = Generator::engine();
+    const int chunk_size = chunk_size_dist(Generator::engine);
+
+    omp_set_num_threads(1);
+    NkLandscape reference;
+    reference.generate_in_chunks(bv_size, k, 1, seed, chunk_size);
+
+    omp_set_num_threads(num_threads_dist(Generator::engine));
+    NkLandscape function;
+    function.generate_in_chunks(bv_size, k, 1, seed, chunk_size);
+
+    bit_vector_t bv(bv_size);
+    for (int j = 0; j < 10; j++) {
+      bv_random(bv);
+      if (function.evaluate(bv) != reference.evaluate(bv))
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check that Nsga2 gives the same results for the same seed and
+    number of threads when offsprings are generated and evaluated in
+    parallel.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include "hnco/multiobjective/algorithms/nsga2.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::multiobjective::algorithm;
+using namespace hnco::multiobjective::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+/// Number of ones in each half of the bit vector
+class HalfOnes: public Function {
+  int _bv_size;
+public:
+  HalfOnes(int n): _bv_size(n) {}
+  int get_bv_size() const override { return _bv_size; }
+  int get_output_size() const override { return 2; }
+  void evaluate(const bit_vector_t& bv, value_t& value) override {
+    value[0] = 0;
+    value[1] = 0;
+    for (int i = 0; i < _bv_size; i++)
+      value[2 * i < _bv_size ? 0 : 1] += bv[i];
+    value[1] = -value[1];
+  }
+};
+
+Population run(int bv_size, int population_size, int num_threads, unsigned seed)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<HalfOnes> copies(num_threads, HalfOnes(bv_size));
+  std::vector<Function *> functions;
+  for (auto& copy : copies)
+    functions.push_back(&copy);
+
+  Generator::set_seed(seed);
+  Nsga2 algorithm(bv_size, 2, population_size);
+  algorithm.set_num_iterations(20);
+  algorithm.minimize(functions);
+  return algorithm.get_solutions();
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 100);
+  std::uniform_int_distribution<int> population_size_dist(10, 50);
+  std::uniform_int_distribution<int> num_threads_dist(2, 4);
+
+  for (int i = 0; i < 10; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    const int population_size = 2 * population_size_dist(Generator::engine);
+    const int num_threads = num_threads_dist(Generator::engine);
+    const unsigned seed = Generator::engine();
+
+    Population a = run(bv_size, population_size, num_threads, seed);
+    Population b = run(bv_size, population_size, num_threads, seed);
+    if (a.bvs != b.bvs || a.values != b.values)
+      return 1;
+
+    Generator::set_seed(seed + 1);
+  }
+
+  return 0;
+}
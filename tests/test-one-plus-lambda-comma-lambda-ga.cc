@@ -0,0 +1,153 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <sstream>              // std::ostringstream
+
+#include "hnco/algorithms/decorators/restart.hh"
+#include "hnco/algorithms/evolutionary-algorithms/one-plus-lambda-comma-lambda-ga.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check(int bv_size, int lambda, int num_threads)
+{
+  omp_set_num_threads(num_threads);
+
+  OneMax f0(bv_size);
+  ProgressTracker f1(&f0);
+  f1.set_record_bit_vector(true);
+  StopOnMaximum f2(&f1);
+
+  std::vector<OneMax> copies(num_threads - 1, OneMax(bv_size));
+  std::vector<Function *> functions = {&f2};
+  for (auto& copy : copies)
+    functions.push_back(&copy);
+
+  OnePlusLambdaCommaLambdaGa algorithm(bv_size, lambda);
+
+  try {
+    algorithm.maximize(functions);
+  }
+  catch (const TargetReached&) {
+    solution_t solution = f2.get_trigger();
+    if (f0.evaluate(solution.first) != f0.get_maximum())
+      return false;
+    auto last_improvement = f1.get_last_improvement();
+    if (f0.evaluate(last_improvement.solution.first) != last_improvement.solution.second)
+      return false;
+    if (last_improvement.solution.second != f0.get_maximum())
+      return false;
+    return true;
+  }
+
+  return false;
+}
+
+bool check_statistics(int bv_size, int lambda, int num_iterations)
+{
+  OneMax f0(bv_size);
+  CallCounter f1(&f0);
+  std::vector<Function *> functions = {&f1};
+
+  // Every mutant flips all the bits and every crossover child is
+  // the selected mutant, hence a single evaluation per iteration
+  OnePlusLambdaCommaLambdaGa algorithm(bv_size, lambda);
+  algorithm.set_mutation_rate(1);
+  algorithm.set_crossover_bias(1);
+  algorithm.set_num_iterations(num_iterations);
+
+  Restart restart(&algorithm);
+  restart.set_num_iterations(1);
+  restart.maximize(functions);
+
+  const long num_skipped = long(num_iterations) * (2 * lambda - 1);
+  if (algorithm.get_num_skipped_evaluations() != num_skipped)
+    return false;
+  if (algorithm.get_num_incremental_evaluations() != num_iterations)
+    return false;
+  if (f1.get_num_calls() != 1 + num_iterations)
+    return false;
+
+  std::ostringstream expected;
+  expected
+    << ",\n  \"num_skipped_evaluations\": "     << num_skipped
+    << ",\n  \"num_incremental_evaluations\": " << num_iterations;
+  std::ostringstream stream;
+  restart.print_statistics(stream);
+  return stream.str() == expected.str();
+}
+
+bool check_counters(int bv_size, int lambda, int num_iterations)
+{
+  OneMax f0(bv_size);
+  CallCounter f1(&f0);
+  std::vector<Function *> functions = {&f1};
+
+  OnePlusLambdaCommaLambdaGa algorithm(bv_size, lambda);
+  algorithm.set_num_iterations(num_iterations);
+  algorithm.maximize(functions);
+
+  // Each offspring is either skipped or evaluated incrementally
+  const long num_skipped = algorithm.get_num_skipped_evaluations();
+  const long num_incremental = algorithm.get_num_incremental_evaluations();
+  if (num_skipped + num_incremental != 2L * lambda * num_iterations)
+    return false;
+  if (f1.get_num_calls() != 1 + num_incremental)
+    return false;
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed(0);
+
+  if (!check_statistics(10, 5, 7))
+    return 1;
+  if (!check_statistics(1, 1, 3))
+    return 1;
+  if (!check_counters(20, 8, 50))
+    return 1;
+
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(1, 100);
+
+  for (int i = 0; i < 50; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    std::uniform_int_distribution<int> lambda_dist(1, bv_size);
+    const int lambda = lambda_dist(Generator::engine);
+    if (!check(bv_size, lambda, 1))
+      return 1;
+    if (!check(bv_size, lambda, 3))
+      return 1;
+  }
+
+  return 0;
+}
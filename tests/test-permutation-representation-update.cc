@@ -0,0 +1,72 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+#include "hnco/representations/permutation.hh"
+
+using namespace hnco::neighborhood;
+using namespace hnco::random;
+using namespace hnco::representation;
+using namespace hnco;
+
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 100;
+  const int num_iterations      = 100;
+
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> num_elements_dist(1, 100);
+  std::uniform_int_distribution<int> num_additional_bits_dist(1, 10);
+
+  for (int i = 0; i < num_runs; i++) {
+    const int num_elements = num_elements_dist(Generator::engine);
+    PermutationRepresentation rep(num_elements, num_additional_bits_dist(Generator::engine));
+    PermutationRepresentation reference_rep = rep;
+
+    const int bv_size = rep.size();
+    StandardBitMutation neighborhood(bv_size);
+    bit_vector_t bv(bv_size);
+    bv_random(bv);
+    neighborhood.set_origin(bv);
+
+    permutation_t permutation(num_elements);
+    permutation_t reference(num_elements);
+    rep.unpack(neighborhood.get_origin(), 0, permutation);
+
+    for (int j = 0; j < num_iterations; j++) {
+      neighborhood.propose();
+      neighborhood.keep();
+
+      std::vector<int> elements;
+      for (auto index : neighborhood.get_flipped_bits())
+        elements.push_back(rep.get_element(0, index));
+      rep.update(neighborhood.get_origin(), 0, permutation, elements);
+
+      reference_rep.unpack(neighborhood.get_origin(), 0, reference);
+      if (permutation != reference)
+        return 1;
+    }
+  }
+
+  return 0;
+}
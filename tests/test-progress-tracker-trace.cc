@@ -0,0 +1,187 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+/** \file
+
+    Check the improvement trace recorded by ProgressTracker: the
+    delta-encoded bit vectors must decode to bit vectors whose values
+    are those of the trace, with full and incremental evaluations,
+    and the CSV and binary exports must contain the whole trace.
+    Also check the recorded bit vector when the trace is not recorded.
+
+*/
+
+#include <cstdint>              // std::int32_t, std::int64_t
+#include <cstring>              // std::memcpy
+#include <sstream>              // std::ostringstream
+#include <string>
+
+#include "hnco/algorithms/evolutionary-algorithms/one-plus-one-ea.hh"
+#include "hnco/exception.hh"
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+template<class T>
+T read_binary(const std::string& data, std::size_t& offset)
+{
+  T value;
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return value;
+}
+
+bool check_binary(const ProgressTracker& tracker, int bv_size, bool record_bit_vector)
+{
+  std::ostringstream stream;
+  tracker.write_trace_binary(stream);
+  const std::string data = stream.str();
+  const auto& trace = tracker.get_trace();
+
+  if (data.compare(0, 8, "HNCOTRC1") != 0)
+    return false;
+  std::size_t offset = 8;
+  if (read_binary<std::int32_t>(data, offset) != (record_bit_vector ? bv_size : 0))
+    return false;
+  if (read_binary<std::int64_t>(data, offset) != std::int64_t(trace.size()))
+    return false;
+  for (const auto& entry : trace) {
+    if (read_binary<std::int32_t>(data, offset) != entry.num_evaluations)
+      return false;
+    if (read_binary<double>(data, offset) != entry.value)
+      return false;
+    if (read_binary<double>(data, offset) != entry.time)
+      return false;
+    if (record_bit_vector) {
+      if (read_binary<std::int32_t>(data, offset) != std::int32_t(entry.flipped_bits.size()))
+        return false;
+      for (int index : entry.flipped_bits)
+        if (read_binary<std::int32_t>(data, offset) != index)
+          return false;
+    }
+  }
+  return offset == data.size();
+}
+
+bool check(int bv_size, bool incremental_evaluation, bool record_bit_vector)
+{
+  OneMax f0(bv_size);
+  ProgressTracker f1(&f0);
+  f1.set_record_trace(true);
+  f1.set_record_bit_vector(record_bit_vector);
+  OnBudgetFunction f2(&f1, 10 * bv_size);
+
+  OnePlusOneEa algorithm(bv_size);
+  algorithm.set_incremental_evaluation(incremental_evaluation);
+  try {
+    algorithm.maximize({&f2});
+  }
+  catch (const LastEvaluation&) {}
+
+  const auto& trace = f1.get_trace();
+  const auto& last_improvement = f1.get_last_improvement();
+  if (trace.empty())
+    return false;
+  if (trace.back().num_evaluations != last_improvement.num_evaluations)
+    return false;
+  if (trace.back().value != last_improvement.solution.second)
+    return false;
+
+  bit_vector_t bv(bv_size, 0);
+  for (std::size_t i = 0; i < trace.size(); i++) {
+    const auto& entry = trace[i];
+    if (i > 0) {
+      if (entry.num_evaluations <= trace[i - 1].num_evaluations)
+        return false;
+      if (entry.value <= trace[i - 1].value)
+        return false;
+      if (entry.time < trace[i - 1].time)
+        return false;
+    }
+    if (record_bit_vector) {
+      bv_flip(bv, entry.flipped_bits);
+      if (f0.evaluate(bv) != entry.value)
+        return false;
+    } else if (!entry.flipped_bits.empty()) {
+      return false;
+    }
+  }
+  if (record_bit_vector && bv != last_improvement.solution.first)
+    return false;
+
+  std::ostringstream csv;
+  f1.write_trace_csv(csv);
+  std::istringstream lines(csv.str());
+  std::string line;
+  std::size_t num_lines = 0;
+  while (std::getline(lines, line))
+    num_lines++;
+  if (num_lines != trace.size() + 1)
+    return false;
+
+  return check_binary(f1, bv_size, record_bit_vector);
+}
+
+bool check_without_trace(int bv_size, bool incremental_evaluation)
+{
+  OneMax f0(bv_size);
+  ProgressTracker f1(&f0);
+  f1.set_record_bit_vector(true);
+  OnBudgetFunction f2(&f1, 10 * bv_size);
+
+  OnePlusOneEa algorithm(bv_size);
+  algorithm.set_incremental_evaluation(incremental_evaluation);
+  try {
+    algorithm.maximize({&f2});
+  }
+  catch (const LastEvaluation&) {}
+
+  const auto& last_improvement = f1.get_last_improvement();
+  return
+    f1.get_trace().empty() &&
+    f0.evaluate(last_improvement.solution.first) == last_improvement.solution.second;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(1, 100);
+
+  for (int i = 0; i < 20; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    for (bool incremental_evaluation : {false, true}) {
+      for (bool record_bit_vector : {false, true})
+        if (!check(bv_size, incremental_evaluation, record_bit_vector))
+          return 1;
+      if (!check_without_trace(bv_size, incremental_evaluation))
+        return 1;
+    }
+  }
+
+  return 0;
+}
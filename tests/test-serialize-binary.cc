@@ -0,0 +1,123 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <fstream>              // std::fstream
+
+#include "hnco/functions/collection/linear-function.hh"
+#include "hnco/functions/collection/max-sat.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool load_fails(LinearFunction& function, std::string path)
+{
+  try { function.load(path); }
+  catch (const std::runtime_error& e) {
+    return true;
+  }
+  return false;
+}
+
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  const std::string path("test-serialize-binary.bin");
+
+  std::uniform_int_distribution<int> dist_n(3, 100);
+
+  for (int i = 0; i < 10; i++) {
+
+    int n = dist_n(Generator::engine);
+
+    MaxSat src;
+    src.random(n, 3, 100);
+    src.save_binary(path);
+    if (!is_binary_archive(path))
+      return 1;
+
+    MaxSat dest;
+    try { dest.load(path); }
+    catch (const std::runtime_error& e) {
+      std::cerr << "main: std::runtime_error: " << e.what() << std::endl;
+      return 1;
+    }
+
+    bit_vector_t bv(n);
+
+    for (int j = 0; j < 1000; j++) {
+      bv_random(bv);
+      if (src.evaluate(bv) != dest.evaluate(bv))
+        return 1;
+    }
+
+  }
+
+  for (int i = 0; i < 10; i++) {
+
+    int n = dist_n(Generator::engine);
+
+    LinearFunction src;
+    src.random(n);
+    save_to_binary_archive(src, path, "LinearFunction");
+
+    LinearFunction dest;
+    dest.load(path);
+
+    bit_vector_t bv(n);
+
+    for (int j = 0; j < 1000; j++) {
+      bv_random(bv);
+      if (src.evaluate(bv) != dest.evaluate(bv))
+        return 1;
+    }
+
+    // Corrupt the last byte of the payload
+    {
+      std::fstream stream(path, std::ios::in | std::ios::out | std::ios::binary);
+      stream.seekg(-1, std::ios::end);
+      char c = stream.get();
+      stream.seekp(-1, std::ios::end);
+      stream.put(c ^ 1);
+    }
+    if (!load_fails(dest, path))
+      return 1;
+
+  }
+
+  // Class mismatch
+  {
+    LinearFunction src;
+    src.random(10);
+    save_to_binary_archive(src, path, "LinearFunction");
+    MaxSat dest;
+    try {
+      dest.load(path);
+      return 1;
+    }
+    catch (const std::runtime_error& e) {}
+  }
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+/** \file
+
+    Check the distribution of the number of bits flipped by
+    StandardBitMutation.
+
+*/
+
+#include <math.h>               // std::abs, std::pow, std::sqrt
+
+#include <algorithm>            // std::is_sorted, std::adjacent_find
+
+#include "hnco/neighborhoods/neighborhood.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::neighborhood;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check(int n, double p, bool allow_no_mutation)
+{
+  const int num_samples = 20000;
+
+  StandardBitMutation neighborhood(n, p);
+  neighborhood.set_allow_no_mutation(allow_no_mutation);
+  bit_vector_t bv(n);
+  bv_random(bv);
+  neighborhood.set_origin(bv);
+
+  double sum = 0;
+  for (int i = 0; i < num_samples; i++) {
+    neighborhood.propose();
+    const sparse_bit_vector_t& flipped_bits = neighborhood.get_flipped_bits();
+    if (!std::is_sorted(flipped_bits.begin(), flipped_bits.end()))
+      return false;
+    if (std::adjacent_find(flipped_bits.begin(), flipped_bits.end()) != flipped_bits.end())
+      return false;
+    if (!flipped_bits.empty() && (flipped_bits.front() < 0 || flipped_bits.back() >= n))
+      return false;
+    if (!allow_no_mutation && flipped_bits.empty())
+      return false;
+    sum += flipped_bits.size();
+    neighborhood.forget();
+  }
+
+  // Expectation of the (conditional) binomial distribution
+  double mean = n * p;
+  double variance = n * p * (1 - p);
+  if (!allow_no_mutation) {
+    double z = 1 - std::pow(1 - p, n);
+    double second_moment = (variance + mean * mean) / z;
+    mean /= z;
+    variance = second_moment - mean * mean;
+  }
+
+  // Five standard deviations of the empirical mean
+  return std::abs(sum / num_samples - mean) < 5 * std::sqrt(variance / num_samples) + 1e-12;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  for (int n : {1, 2, 10, 100, 1000}) {
+    for (double p : {1 / double(n), 0.5 / n, 2.0 / n, 0.5, 1.0}) {
+      if (p > 1)
+        continue;
+      if (!check(n, p, false))
+        return 1;
+      if (!check(n, p, true))
+        return 1;
+    }
+  }
+
+  return 0;
+}
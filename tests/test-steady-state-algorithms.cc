@@ -0,0 +1,138 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+/** \file
+
+    Check steady-state algorithms with one or several threads: number
+    of integrated candidates, statistics printed through a decorator,
+    consistency of the solution, and budget exhaustion through the
+    first function.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <sstream>              // std::ostringstream
+#include <string>
+
+#include "hnco/algorithms/decorators/restart.hh"
+#include "hnco/algorithms/evolutionary-algorithms/mu-plus-one-ea.hh"
+#include "hnco/algorithms/evolutionary-algorithms/steady-state-ga.hh"
+#include "hnco/exception.hh"
+#include "hnco/functions/collection/walsh/walsh-expansion-2.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool check(SteadyStateAlgorithm& algorithm, WalshExpansion2& function, int num_threads, int num_iterations)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<WalshExpansion2> copies(num_threads, function);
+  std::vector<Function *> functions;
+  for (auto& copy : copies)
+    functions.push_back(&copy);
+
+  // Statistics must go through the decorator
+  algorithm.set_num_iterations(num_iterations);
+  Restart restart(&algorithm);
+  restart.set_num_iterations(1);
+  restart.maximize(functions);
+
+  if (algorithm.get_num_evaluations() != num_iterations)
+    return false;
+
+  std::ostringstream stream;
+  restart.print_statistics(stream);
+  const std::string prefix = ",\n  \"num_steady_state_evaluations\": " + std::to_string(num_iterations) + ",\n  \"throughput\": ";
+  if (stream.str().compare(0, prefix.size(), prefix) != 0)
+    return false;
+
+  const solution_t& solution = restart.get_solution();
+  return function.evaluate(solution.first) == solution.second;
+}
+
+bool check_budget(SteadyStateAlgorithm& algorithm, const WalshExpansion2& function, int num_threads, int population_size, int budget)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<WalshExpansion2> copies(num_threads, function);
+  OnBudgetFunction controller(&copies[0], budget);
+  std::vector<Function *> functions;
+  functions.push_back(&controller);
+  for (int k = 1; k < num_threads; k++)
+    functions.push_back(&copies[k]);
+
+  algorithm.set_num_iterations(0);
+  try {
+    algorithm.maximize(functions);
+    return false;
+  }
+  catch (const LastEvaluation&) {}
+
+  if (controller.get_num_calls() != budget)
+    return false;
+
+  return algorithm.get_num_evaluations() == budget - population_size;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 100);
+  std::uniform_int_distribution<int> population_size_dist(20, 50);
+  std::uniform_int_distribution<int> num_threads_dist(1, 4);
+  std::uniform_int_distribution<int> num_iterations_dist(1, 1000);
+
+  for (int i = 0; i < 20; i++) {
+    const int bv_size = bv_size_dist(Generator::engine);
+    const int population_size = population_size_dist(Generator::engine);
+    const int num_threads = num_threads_dist(Generator::engine);
+    const int num_iterations = num_iterations_dist(Generator::engine);
+
+    WalshExpansion2 function;
+    function.generate(bv_size, Generator::normal, Generator::normal);
+
+    {
+      MuPlusOneEa algorithm(bv_size, population_size);
+      if (!check(algorithm, function, num_threads, num_iterations))
+        return 1;
+      if (!check_budget(algorithm, function, num_threads, population_size, population_size + num_iterations))
+        return 1;
+    }
+
+    {
+      SteadyStateGa algorithm(bv_size, population_size);
+      if (!check(algorithm, function, num_threads, num_iterations))
+        return 1;
+      if (!check_budget(algorithm, function, num_threads, population_size, population_size + num_iterations))
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+/** \file
+
+    Check that algorithms end a run without exception when
+    controllers request a stop on a stop token, with exact budget and
+    target accounting, in serial and parallel modes. Also check that
+    StopOnMaximum can be reused across runs, with or without a stop
+    token.
+
+*/
+
+#include <omp.h>                // omp_set_num_threads
+
+#include <functional>           // std::function
+#include <memory>               // std::unique_ptr
+
+#include "hnco/algorithms/all.hh"
+#include "hnco/exception.hh"
+#include "hnco/functions/collection/theory.hh"
+#include "hnco/functions/controllers/controller.hh"
+#include "hnco/random.hh"
+#include "hnco/stop-token.hh"
+
+using namespace hnco::algorithm;
+using namespace hnco::exception;
+using namespace hnco::function::controller;
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+using Factory = std::function<Algorithm *(int)>;
+
+bool check_budget(Factory make, int n, int num_threads, int budget)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<OneMax> copies(num_threads, OneMax(n));
+  StopToken token;
+  ProgressTracker tracker(&copies[0]);
+  OnBudgetFunction controller(&tracker, budget);
+  controller.set_stop_token(&token);
+  std::vector<Function *> functions{&controller};
+  for (int k = 1; k < num_threads; k++)
+    functions.push_back(&copies[k]);
+
+  std::unique_ptr<Algorithm> algorithm(make(n));
+  try {
+    algorithm->maximize(functions);
+    algorithm->finalize();
+  }
+  catch (...) {
+    return false;
+  }
+
+  if (!token.stop_requested())
+    return false;
+  if (tracker.get_num_calls() != budget)
+    return false;
+
+  const solution_t& solution = algorithm->get_solution();
+  return
+    copies[0].evaluate(solution.first) == solution.second &&
+    solution.second <= tracker.get_last_improvement().solution.second;
+}
+
+bool check_target(Factory make, int n, int num_threads)
+{
+  omp_set_num_threads(num_threads);
+
+  std::vector<OneMax> copies(num_threads, OneMax(n));
+  StopToken token;
+  ProgressTracker tracker(&copies[0]);
+  OnBudgetFunction budget(&tracker, 1000000);
+  budget.set_stop_token(&token);
+  StopOnMaximum controller(&budget);
+  controller.set_stop_token(&token);
+  std::vector<Function *> functions{&controller};
+  for (int k = 1; k < num_threads; k++)
+    functions.push_back(&copies[k]);
+
+  std::unique_ptr<Algorithm> algorithm(make(n));
+  try {
+    algorithm->maximize(functions);
+  }
+  catch (...) {
+    return false;
+  }
+
+  if (!controller.is_target_reached())
+    return false;
+  if (controller.get_trigger().second != n)
+    return false;
+  return tracker.get_num_calls() == tracker.get_last_improvement().num_evaluations;
+}
+
+bool check_reuse(int n)
+{
+  OneMax function(n);
+  CallCounter counter(&function);
+  StopOnMaximum controller(&counter);
+  OnePlusOneEa algorithm(n);
+
+  // Without a stop token, each run must evaluate until the target
+  for (int run = 0; run < 3; run++) {
+    const int num_calls = counter.get_num_calls();
+    try {
+      algorithm.maximize({&controller});
+      return false;
+    }
+    catch (const TargetReached&) {}
+    if (counter.get_num_calls() - num_calls < 2)
+      return false;
+    if (controller.get_trigger().second != n)
+      return false;
+  }
+
+  // With a stop token, the controller and the token must be reset
+  StopToken token;
+  controller.set_stop_token(&token);
+  for (int run = 0; run < 3; run++) {
+    const int num_calls = counter.get_num_calls();
+    controller.reset();
+    token.reset();
+    try {
+      algorithm.maximize({&controller});
+    }
+    catch (...) {
+      return false;
+    }
+    if (!controller.is_target_reached())
+      return false;
+    if (counter.get_num_calls() - num_calls < 2)
+      return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  Generator::set_seed();
+
+  std::vector<Factory> factories = {
+    [](int n) { return new OnePlusOneEa(n); },
+    [](int n) { return new MuPlusLambdaEa(n, 5, 10); },
+    [](int n) { return new MuCommaLambdaEa(n, 5, 20); },
+    [](int n) { return new TwoRateOnePlusLambdaEa(n, 10); },
+    [](int n) { return new GeneticAlgorithm(n, 20); },
+    [](int n) { return new OnePlusLambdaCommaLambdaGa(n, 10); },
+    [](int n) { return new MuPlusOneEa(n, 5); },
+    [](int n) { return new Pbil(n, 20); },
+    [](int n) { return new Umda(n, 20); }
+  };
+  const int num_target_factories = 5;
+
+  std::uniform_int_distribution<int> bv_size_dist(10, 30);
+  std::uniform_int_distribution<int> budget_dist(1, 500);
+
+  for (int i = 0; i < 5; i++) {
+    const int n = bv_size_dist(Generator::engine);
+    if (!check_reuse(n))
+      return 1;
+    for (int num_threads : {1, 3}) {
+      for (auto& make : factories)
+        if (!check_budget(make, n, num_threads, budget_dist(Generator::engine)))
+          return 1;
+      for (int j = 0; j < num_target_factories; j++)
+        if (!check_target(factories[j], n, num_threads))
+          return 1;
+    }
+  }
+
+  return 0;
+}
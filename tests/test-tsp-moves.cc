@@ -0,0 +1,97 @@
+/* Copyright (C) 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024 Arnaud Berny
+
+   This file is part of HNCO.
+
+   HNCO is free software: you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as
+   published by the Free Software Foundation, either version 3 of the
+   License, or (at your option) any later version.
+
+   HNCO is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+   or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General
+   Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with HNCO. If not, see
+   <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <cmath>                // std::abs
+
+#include "hnco/functions/collection/tsp.hh"
+#include "hnco/permutation.hh"
+#include "hnco/random.hh"
+
+using namespace hnco::function;
+using namespace hnco::random;
+using namespace hnco;
+
+
+bool almost_equal(double a, double b)
+{
+  return std::abs(a - b) <= 1e-6 * (1 + std::abs(a) + std::abs(b));
+}
+
+int main(int argc, char *argv[])
+{
+  const int num_runs            = 100;
+  const int num_iterations      = 100;
+
+  Generator::set_seed();
+
+  std::uniform_int_distribution<int> num_cities_dist(4, 50);
+
+  for (int i = 0; i < num_runs; i++) {
+    const int n = num_cities_dist(Generator::engine);
+    Tsp function;
+    function.generate(n, Generator::uniform);
+
+    permutation_t tour(n);
+    perm_random(tour);
+    double length = function.get_length(tour);
+
+    for (int j = 0; j < num_iterations; j++) {
+      std::uniform_int_distribution<int> index_dist(0, n - 1);
+      int a = index_dist(Generator::engine);
+      int b = index_dist(Generator::engine);
+      if (a == b)
+        continue;
+      if (a > b)
+        std::swap(a, b);
+      length += function.get_two_opt_delta(tour, a, b);
+      function.apply_two_opt(tour, a, b);
+      if (!perm_is_valid(tour) || !almost_equal(length, function.get_length(tour)))
+        return 1;
+
+      std::uniform_int_distribution<int> length_dist(1, n - 2);
+      int segment_length = length_dist(Generator::engine);
+      int start = std::uniform_int_distribution<int>(0, n - segment_length)(Generator::engine);
+      int destination = index_dist(Generator::engine);
+      if (destination >= start - 1 && destination < start + segment_length)
+        continue;
+      if (destination == (start - 1 + n) % n)
+        continue;
+      length += function.get_or_opt_delta(tour, start, segment_length, destination);
+      function.apply_or_opt(tour, start, segment_length, destination);
+      if (!perm_is_valid(tour) || !almost_equal(length, function.get_length(tour)))
+        return 1;
+    }
+
+    const bool with_neighbors = Generator::bernoulli();
+    if (with_neighbors)
+      function.compute_nearest_neighbors(5);
+    function.two_opt(tour);
+    if (!perm_is_valid(tour) || function.get_length(tour) > length + 1e-6)
+      return 1;
+    if (with_neighbors)
+      continue;
+    for (int a = 0; a < n - 1; a++)
+      for (int b = a + 1; b < n; b++)
+        if (function.get_two_opt_delta(tour, a, b) < -1e-6)
+          return 1;
+  }
+
+  return 0;
+}
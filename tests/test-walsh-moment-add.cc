@@ -37,22 +37,27 @@ bool check()
   for (int c = 0; c < 100; c++) {
     const int n = dist_n(Generator::engine);
     const int population_size = dist_population_size(Generator::engine);
-    bit_vector_t bv(n);
+    std::vector<bit_vector_t> bvs(population_size, bit_vector_t(n));
     TM triangular(n);
+    TM batch(n);
     SM symmetric(n);
     triangular.init();
+    batch.init();
     symmetric.init();
-    for (int k = 0; k < population_size; k++) {
+    for (auto& bv : bvs) {
       bv_random(bv);
       triangular.add(bv);
       symmetric.add(bv);
     }
+    batch.add(population_size, [&bvs](int k) -> const bit_vector_t& { return bvs[k]; });
     for (int i = 0; i < n; i++)
-      if (triangular.first_moment[i] != symmetric.first_moment[i])
+      if (triangular.first_moment[i] != symmetric.first_moment[i] ||
+          batch.first_moment[i] != symmetric.first_moment[i])
         return false;
     for (int i = 0; i < n; i++)
       for (int j = 0; j < i; j++)
-        if (triangular.second_moment[i][j] != symmetric.second_moment[i][j])
+        if (triangular.get_second_moment(i, j) != symmetric.second_moment[i][j] ||
+            batch.get_second_moment(i, j) != symmetric.second_moment[i][j])
           return false;
   }
   return true;